@@ -0,0 +1,198 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Bit-exactness check of the mixing kernels, compares every kernel
+ * supported by the cpu against the memset + SDL_MixAudioFormat path
+ * the audio callback used before, for every volume, with and without
+ * swapped channels and for buffer sizes which end in the scalar tail.
+ * The float kernels are compared against the scalar float kernel.
+ * Doesn't require an audio device.
+ *
+ * usage: RMG-Audio-MixerCheck [--seed N]
+ *
+ * returns non-zero when any output differs */
+#include "mixer.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <SDL.h>
+
+//
+// Local Defines
+//
+
+/* assume 2x16bit interleaved channels */
+#define BYTES_PER_FRAME 4
+
+/* largest buffer checked, in frames */
+#define MAX_FRAMES 1031
+
+/* amount of random buffers checked per volume */
+#define BUFFERS_PER_VOLUME 8
+
+//
+// Local Functions
+//
+
+/* fills the buffer with random samples, with the extremes mixed in,
+ * so the saturation and the rounding of negative samples are covered */
+static void randomize_samples(std::mt19937& rng, std::vector<int16_t>& samples)
+{
+    for (int16_t& sample : samples)
+    {
+        switch (rng() % 8)
+        {
+        case 0:
+            sample = INT16_MIN;
+            break;
+        case 1:
+            sample = INT16_MAX;
+            break;
+        case 2:
+            sample = (int16_t)((int)(rng() % 256) - 128);
+            break;
+        default:
+            sample = (int16_t)((int)(rng() % 65536) - 32768);
+            break;
+        }
+    }
+}
+
+/* the channel swap & mixing of the audio callback before the mixing kernels */
+static void reference_mix(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels)
+{
+    std::vector<int16_t> swapped(src, src + frames * 2);
+
+    if (swap_channels)
+    {
+        for (size_t i = 0; i < frames; i++)
+        {
+            swapped[i * 2]     = src[i * 2 + 1];
+            swapped[i * 2 + 1] = src[i * 2];
+        }
+    }
+
+    memset(dst, 0, frames * BYTES_PER_FRAME);
+    SDL_MixAudioFormat((Uint8*)dst, (const Uint8*)swapped.data(), AUDIO_S16SYS, (Uint32)(frames * BYTES_PER_FRAME), volume);
+}
+
+static size_t find_mismatch(const void* a, const void* b, size_t count, size_t size)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (memcmp((const uint8_t*)a + i * size, (const uint8_t*)b + i * size, size) != 0)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+//
+// Check
+//
+
+int main(int argc, char** argv)
+{
+    unsigned int seed = 26;
+    uint64_t checks = 0;
+    uint64_t mismatches = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--seed") == 0 && (i + 1) < argc)
+        {
+            seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::mt19937 rng(seed);
+
+    /* one extra sample, so the kernels also read from unaligned buffers */
+    std::vector<int16_t> source(MAX_FRAMES * 2 + 1);
+    std::vector<int16_t> reference(MAX_FRAMES * 2);
+    std::vector<int16_t> output(MAX_FRAMES * 2);
+    std::vector<float>   referenceFloat(MAX_FRAMES * 2);
+    std::vector<float>   outputFloat(MAX_FRAMES * 2);
+
+    for (size_t kernel = 0; kernel < mix_samples_kernel_count(); kernel++)
+    {
+        uint64_t kernelMismatches = 0;
+
+        for (int volume = 0; volume <= MIXER_MAX_VOLUME; volume++)
+        {
+            for (int buffer = 0; buffer < BUFFERS_PER_VOLUME; buffer++)
+            {
+                const size_t frames = (buffer == 0) ? MAX_FRAMES : (rng() % MAX_FRAMES);
+                const int16_t* src  = source.data() + (buffer & 1);
+
+                randomize_samples(rng, source);
+
+                for (bool swap_channels : { false, true })
+                {
+                    reference_mix(reference.data(), src, frames, volume, swap_channels);
+
+                    mix_samples_select_kernel(kernel);
+                    mix_samples(output.data(), src, frames, volume, swap_channels);
+
+                    size_t index = find_mismatch(reference.data(), output.data(), frames * 2, sizeof(int16_t));
+                    if (index != frames * 2)
+                    {
+                        if (kernelMismatches == 0)
+                        {
+                            fprintf(stderr, "%s: sample %zu of %zu frames differs at volume %d%s: %d, expected %d\n",
+                                mix_samples_kernel_name(), index, frames, volume, swap_channels ? " (swapped)" : "",
+                                output[index], reference[index]);
+                        }
+                        kernelMismatches++;
+                    }
+
+                    mix_samples_select_kernel(0);
+                    mix_samples_f32(referenceFloat.data(), src, frames, volume, swap_channels);
+
+                    mix_samples_select_kernel(kernel);
+                    mix_samples_f32(outputFloat.data(), src, frames, volume, swap_channels);
+
+                    index = find_mismatch(referenceFloat.data(), outputFloat.data(), frames * 2, sizeof(float));
+                    if (index != frames * 2)
+                    {
+                        if (kernelMismatches == 0)
+                        {
+                            fprintf(stderr, "%s: float sample %zu of %zu frames differs at volume %d%s: %.9g, expected %.9g\n",
+                                mix_samples_kernel_name(), index, frames, volume, swap_channels ? " (swapped)" : "",
+                                outputFloat[index], referenceFloat[index]);
+                        }
+                        kernelMismatches++;
+                    }
+
+                    checks += 2;
+                }
+            }
+        }
+
+        printf("%-8s %s\n", mix_samples_kernel_name(), kernelMismatches == 0 ? "ok" : "MISMATCH");
+        mismatches += kernelMismatches;
+    }
+
+    printf("%llu checks, %llu mismatches\n", (unsigned long long)checks, (unsigned long long)mismatches);
+
+    return mismatches == 0 ? 0 : 1;
+}
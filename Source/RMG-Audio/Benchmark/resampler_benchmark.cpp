@@ -0,0 +1,602 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Offline benchmark of the resamplers, drives every resampler_interface
+ * with synthetic signals at the frequencies the N64 DAC produces and
+ * measures throughput, THD+N, pitch error, aliasing rejection,
+ * frequency response and group delay. Doesn't require an audio device.
+ *
+ * usage: RMG-Audio-Benchmark [--json] [--seconds N] [resampler-id...]
+ */
+#include "Resamplers/resamplers.hpp"
+#include "main.hpp"
+
+#include <RMG-Core/m64p/api/m64p_types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+//
+// Local Defines
+//
+
+/* assume 2x16bit interleaved channels */
+#define BYTES_PER_SAMPLE 4
+
+/* amount of output frames requested per resample call, like the audio callback */
+#define CHUNK_FRAMES 1024
+
+/* amplitude of the test signals, leaves headroom for overshoot */
+#define SIGNAL_AMPLITUDE 16384.0
+
+/* test tone used for THD+N */
+#define TEST_TONE_FREQUENCY 1000.0
+
+/* maximum amount of output frames analyzed by the sine fits */
+#define ANALYSIS_FRAMES 16384
+
+/* amount of bands the sine sweep is split into */
+#define SWEEP_BANDS 16
+
+#define NTSC_VI_CLOCK 48681812
+
+//
+// Local Structures
+//
+
+struct benchmark_result
+{
+    std::string resampler_id;
+    unsigned int src_freq;
+    unsigned int dst_freq;
+
+    /* input samples per second */
+    double throughput;
+    double thd_n_db;
+    /* deviation of the test tone frequency, caused by rounding of the ratio */
+    double pitch_error_cents;
+    double aliasing_rejection_db;
+    /* worst deviation from unity gain within the sweep (in dB) */
+    double sweep_min_db;
+    double sweep_max_db;
+    double group_delay_ms;
+};
+
+//
+// Local Variables
+//
+
+static const char* l_ResamplerIds[] =
+{
+    "trivial",
+    "speex-fixed-0", "speex-fixed-1", "speex-fixed-2",
+    "speex-fixed-3", "speex-fixed-4", "speex-fixed-5",
+    "speex-fixed-6", "speex-fixed-7", "speex-fixed-8",
+    "speex-fixed-9", "speex-fixed-10",
+    "src-sinc-best-quality", "src-sinc-medium-quality",
+    "src-sinc-fastest", "src-zero-order-hold", "src-linear",
+};
+
+/* frequencies games request, the DAC can only approximate them */
+static const unsigned int l_RequestedFrequencies[] =
+{
+    11025, 16000, 22050, 32000, 44100, 48000
+};
+
+/* output frequencies of sdl_backend, 44100 by default and 48000 for native output */
+static const unsigned int l_OutputFrequencies[] =
+{
+    44100, 48000
+};
+
+static bool l_Verbose = false;
+
+//
+// Local Functions
+//
+
+static unsigned int dac_frequency(unsigned int requested_frequency)
+{
+    /* matches dacrate2freq() in main.cpp */
+    unsigned int dacrate = (unsigned int)std::lround((double)NTSC_VI_CLOCK / requested_frequency) - 1;
+    return NTSC_VI_CLOCK / (dacrate + 1);
+}
+
+static std::vector<int16_t> make_stereo(const std::vector<double>& signal)
+{
+    std::vector<int16_t> samples(signal.size() * 2);
+
+    for (size_t i = 0; i < signal.size(); i++)
+    {
+        int16_t sample = (int16_t)std::clamp(std::lround(signal[i]), -32768L, 32767L);
+        samples[i * 2] = sample;
+        samples[i * 2 + 1] = sample;
+    }
+
+    return samples;
+}
+
+static std::vector<double> make_sine(double frequency, unsigned int sample_rate, size_t frames)
+{
+    std::vector<double> signal(frames);
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        signal[i] = SIGNAL_AMPLITUDE * std::sin(2.0 * M_PI * frequency * i / sample_rate);
+    }
+
+    return signal;
+}
+
+/* exponential sweep from start_frequency to end_frequency */
+static std::vector<double> make_sweep(double start_frequency, double end_frequency, unsigned int sample_rate, size_t frames)
+{
+    std::vector<double> signal(frames);
+    const double duration = (double)frames / sample_rate;
+    const double k = std::log(end_frequency / start_frequency);
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        double t = (double)i / sample_rate;
+        double phase = 2.0 * M_PI * start_frequency * duration / k * (std::exp(t / duration * k) - 1.0);
+        signal[i] = SIGNAL_AMPLITUDE * std::sin(phase);
+    }
+
+    return signal;
+}
+
+static std::vector<double> make_impulse(size_t position, size_t frames)
+{
+    std::vector<double> signal(frames, 0.0);
+    signal[position] = SIGNAL_AMPLITUDE;
+    return signal;
+}
+
+static std::vector<double> make_noise(size_t frames)
+{
+    std::vector<double> signal(frames);
+    std::mt19937 generator(64);
+    std::uniform_real_distribution<double> distribution(-SIGNAL_AMPLITUDE, SIGNAL_AMPLITUDE);
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        signal[i] = distribution(generator);
+    }
+
+    return signal;
+}
+
+/* resamples input in CHUNK_FRAMES sized calls, the same way the audio callback does,
+ * returns the left channel of the output, stops when the input runs low */
+static std::vector<double> resample(const char* resampler_id, unsigned int src_freq, unsigned int dst_freq,
+                                    const std::vector<int16_t>& input, double* seconds)
+{
+    void* resampler = nullptr;
+    const struct resampler_interface* iresampler = get_iresampler(resampler_id, &resampler);
+    std::vector<double> output;
+
+    if (resampler == nullptr)
+    {
+        return output;
+    }
+
+    iresampler->configure(resampler, src_freq, dst_freq);
+
+    const size_t input_size = input.size() * sizeof(int16_t);
+    /* keep enough input around for the high quality resamplers */
+    const size_t margin = ((size_t)CHUNK_FRAMES * 4 * src_freq / dst_freq) * BYTES_PER_SAMPLE;
+    int16_t chunk[CHUNK_FRAMES * 2];
+    size_t position = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (position + margin < input_size)
+    {
+        size_t consumed = iresampler->resample(resampler, (const unsigned char*)input.data() + position,
+                input_size - position, chunk, sizeof(chunk));
+        position += consumed;
+
+        for (size_t i = 0; i < CHUNK_FRAMES; i++)
+        {
+            output.push_back(chunk[i * 2]);
+        }
+
+        if (consumed == 0)
+        {
+            break;
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    if (seconds != nullptr)
+    {
+        *seconds = std::chrono::duration<double>(end - start).count();
+    }
+
+    iresampler->release(resampler);
+    return output;
+}
+
+static double rms(const double* signal, size_t frames)
+{
+    double sum = 0.0;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        sum += signal[i] * signal[i];
+    }
+
+    return std::sqrt(sum / std::max<size_t>(frames, 1));
+}
+
+static double to_db(double ratio)
+{
+    return 20.0 * std::log10(std::max(ratio, 1e-12));
+}
+
+/* least squares fit of a sine with the given frequency, returns
+ * the rms of the fitted sine and of the residual (noise + distortion) */
+static void fit_sine(const double* signal, size_t frames, double frequency, unsigned int sample_rate,
+                     double* fundamental_rms, double* residual_rms)
+{
+    double ss = 0.0, cc = 0.0, sc = 0.0, xs = 0.0, xc = 0.0;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        double s = std::sin(2.0 * M_PI * frequency * i / sample_rate);
+        double c = std::cos(2.0 * M_PI * frequency * i / sample_rate);
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+        xs += signal[i] * s;
+        xc += signal[i] * c;
+    }
+
+    double determinant = ss * cc - sc * sc;
+    double a = (xs * cc - xc * sc) / determinant;
+    double b = (xc * ss - xs * sc) / determinant;
+
+    double residual = 0.0;
+    for (size_t i = 0; i < frames; i++)
+    {
+        double s = std::sin(2.0 * M_PI * frequency * i / sample_rate);
+        double c = std::cos(2.0 * M_PI * frequency * i / sample_rate);
+        double error = signal[i] - (a * s + b * c);
+        residual += error * error;
+    }
+
+    *fundamental_rms = std::sqrt((a * a + b * b) / 2.0);
+    *residual_rms = std::sqrt(residual / std::max<size_t>(frames, 1));
+}
+
+/* finds the frequency near nominal_frequency which fits best, resamplers which
+ * round the ratio per call shift the frequency slightly, which would otherwise
+ * be counted as noise */
+static double fit_frequency(const double* signal, size_t frames, double nominal_frequency, unsigned int sample_rate)
+{
+    double best_frequency = nominal_frequency;
+    double range = nominal_frequency * 0.02;
+
+    for (int pass = 0; pass < 4; pass++)
+    {
+        const int steps = 40;
+        double center = best_frequency;
+        double best_fundamental = -1.0;
+
+        for (int i = -steps; i <= steps; i++)
+        {
+            double frequency = center + range * i / steps;
+            double fundamental, residual;
+            fit_sine(signal, frames, frequency, sample_rate, &fundamental, &residual);
+            if (fundamental > best_fundamental)
+            {
+                best_fundamental = fundamental;
+                best_frequency = frequency;
+            }
+        }
+
+        range /= steps / 2;
+    }
+
+    return best_frequency;
+}
+
+/* skips the start of the output, where the filters are still settling */
+static size_t settle_frames(unsigned int dst_freq)
+{
+    return dst_freq / 10;
+}
+
+static void measure_thd_n(const char* id, unsigned int src_freq, unsigned int dst_freq, double* thd_n_db, double* pitch_error_cents)
+{
+    std::vector<int16_t> input = make_stereo(make_sine(TEST_TONE_FREQUENCY, src_freq, src_freq));
+    std::vector<double> output = resample(id, src_freq, dst_freq, input, nullptr);
+    size_t skip = settle_frames(dst_freq);
+
+    *thd_n_db = NAN;
+    *pitch_error_cents = NAN;
+
+    if (output.size() <= skip)
+    {
+        return;
+    }
+
+    const double* signal = output.data() + skip;
+    size_t frames = std::min<size_t>(output.size() - skip, ANALYSIS_FRAMES);
+    double frequency = fit_frequency(signal, frames, TEST_TONE_FREQUENCY, dst_freq);
+
+    double fundamental, residual;
+    fit_sine(signal, frames, frequency, dst_freq, &fundamental, &residual);
+    *thd_n_db = to_db(residual / fundamental);
+    *pitch_error_cents = 1200.0 * std::log2(frequency / TEST_TONE_FREQUENCY);
+}
+
+/* feeds a tone close to the input nyquist frequency, when it's above the output
+ * nyquist frequency it should be removed entirely, otherwise everything besides
+ * the tone is an alias or image */
+static double measure_aliasing_rejection(const char* id, unsigned int src_freq, unsigned int dst_freq)
+{
+    const double frequency = src_freq * 0.45;
+    std::vector<double> signal = make_sine(frequency, src_freq, src_freq);
+    std::vector<int16_t> input = make_stereo(signal);
+    std::vector<double> output = resample(id, src_freq, dst_freq, input, nullptr);
+    size_t skip = settle_frames(dst_freq);
+
+    if (output.size() <= skip)
+    {
+        return NAN;
+    }
+
+    const double* output_signal = output.data() + skip;
+    size_t frames = std::min<size_t>(output.size() - skip, ANALYSIS_FRAMES);
+
+    if (frequency >= dst_freq / 2.0)
+    {
+        return -to_db(rms(output_signal, frames) / rms(signal.data(), signal.size()));
+    }
+
+    double fundamental, residual;
+    fit_sine(output_signal, frames, fit_frequency(output_signal, frames, frequency, dst_freq), dst_freq, &fundamental, &residual);
+    return -to_db(residual / fundamental);
+}
+
+/* splits a sweep up to 0.4 * the lowest nyquist frequency
+ * into bands and compares their level to the input */
+static void measure_sweep(const char* id, unsigned int src_freq, unsigned int dst_freq, double* min_db, double* max_db)
+{
+    const double start_frequency = 20.0;
+    const double end_frequency = std::min(src_freq, dst_freq) * 0.4;
+    const size_t frames = src_freq * 2;
+    std::vector<int16_t> input = make_stereo(make_sweep(start_frequency, end_frequency, src_freq, frames));
+    std::vector<double> output = resample(id, src_freq, dst_freq, input, nullptr);
+
+    *min_db = INFINITY;
+    *max_db = -INFINITY;
+
+    /* the sweep is time aligned with the output apart from the group delay,
+     * which is small compared to a band */
+    const double input_rms = SIGNAL_AMPLITUDE / std::sqrt(2.0);
+    const size_t band_frames = ((frames * (size_t)dst_freq) / src_freq) / SWEEP_BANDS;
+
+    for (size_t band = 1; band < SWEEP_BANDS; band++)
+    {
+        size_t start = band * band_frames;
+        if (start + band_frames > output.size())
+        {
+            break;
+        }
+
+        double level = to_db(rms(output.data() + start, band_frames) / input_rms);
+        *min_db = std::min(*min_db, level);
+        *max_db = std::max(*max_db, level);
+    }
+}
+
+static double measure_group_delay(const char* id, unsigned int src_freq, unsigned int dst_freq)
+{
+    const size_t position = src_freq / 4;
+    std::vector<int16_t> input = make_stereo(make_impulse(position, src_freq));
+    std::vector<double> output = resample(id, src_freq, dst_freq, input, nullptr);
+
+    if (output.empty())
+    {
+        return NAN;
+    }
+
+    size_t peak = 0;
+    for (size_t i = 1; i < output.size(); i++)
+    {
+        if (std::fabs(output[i]) > std::fabs(output[peak]))
+        {
+            peak = i;
+        }
+    }
+
+    /* parabolic interpolation of the peak position */
+    double offset = 0.0;
+    if (peak > 0 && peak + 1 < output.size())
+    {
+        double a = output[peak - 1];
+        double b = output[peak];
+        double c = output[peak + 1];
+        double denominator = a - 2.0 * b + c;
+        if (denominator != 0.0)
+        {
+            offset = 0.5 * (a - c) / denominator;
+        }
+    }
+
+    return ((peak + offset) / dst_freq - (double)position / src_freq) * 1000.0;
+}
+
+static double measure_throughput(const char* id, unsigned int src_freq, unsigned int dst_freq, unsigned int seconds)
+{
+    std::vector<int16_t> input = make_stereo(make_noise((size_t)src_freq * seconds));
+    double elapsed = 0.0;
+    std::vector<double> output = resample(id, src_freq, dst_freq, input, &elapsed);
+
+    if (output.empty() || elapsed <= 0.0)
+    {
+        return NAN;
+    }
+
+    /* the amount of consumed input matches the produced output */
+    return (output.size() * (double)src_freq / dst_freq) / elapsed;
+}
+
+static void print_table(const std::vector<benchmark_result>& results)
+{
+    printf("%-24s %8s %8s %14s %10s %10s %12s %18s %12s\n",
+        "resampler", "src", "dst", "samples/s", "THD+N dB", "pitch ct", "alias dB", "sweep dB (min/max)", "delay ms");
+
+    for (const benchmark_result& result : results)
+    {
+        printf("%-24s %8u %8u %14.0f %10.1f %10.2f %12.1f %8.2f/%-9.2f %12.3f\n",
+            result.resampler_id.c_str(), result.src_freq, result.dst_freq,
+            result.throughput, result.thd_n_db, result.pitch_error_cents, result.aliasing_rejection_db,
+            result.sweep_min_db, result.sweep_max_db, result.group_delay_ms);
+    }
+}
+
+static void print_json_number(double value)
+{
+    if (std::isfinite(value))
+    {
+        printf("%.4f", value);
+    }
+    else
+    {
+        printf("null");
+    }
+}
+
+static void print_json(const std::vector<benchmark_result>& results)
+{
+    printf("[\n");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const benchmark_result& result = results[i];
+
+        printf("  { \"resampler\": \"%s\", \"src_freq\": %u, \"dst_freq\": %u, ",
+            result.resampler_id.c_str(), result.src_freq, result.dst_freq);
+        printf("\"throughput\": ");
+        print_json_number(result.throughput);
+        printf(", \"thd_n_db\": ");
+        print_json_number(result.thd_n_db);
+        printf(", \"pitch_error_cents\": ");
+        print_json_number(result.pitch_error_cents);
+        printf(", \"aliasing_rejection_db\": ");
+        print_json_number(result.aliasing_rejection_db);
+        printf(", \"sweep_min_db\": ");
+        print_json_number(result.sweep_min_db);
+        printf(", \"sweep_max_db\": ");
+        print_json_number(result.sweep_max_db);
+        printf(", \"group_delay_ms\": ");
+        print_json_number(result.group_delay_ms);
+        printf(" }%s\n", (i + 1 < results.size()) ? "," : "");
+    }
+
+    printf("]\n");
+}
+
+//
+// Exported Functions
+//
+
+/* the resamplers log through DebugMessage, which is normally provided by main.cpp */
+void DebugMessage(int level, const char* message, ...)
+{
+    if (level > M64MSG_WARNING && !l_Verbose)
+    {
+        return;
+    }
+
+    va_list args;
+    va_start(args, message);
+    vfprintf(stderr, message, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    unsigned int seconds = 5;
+    std::vector<std::string> resampler_ids;
+    std::vector<benchmark_result> results;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            json = true;
+        }
+        else if (strcmp(argv[i], "--verbose") == 0)
+        {
+            l_Verbose = true;
+        }
+        else if (strcmp(argv[i], "--seconds") == 0 && (i + 1) < argc)
+        {
+            seconds = std::max(1, atoi(argv[++i]));
+        }
+        else
+        {
+            resampler_ids.push_back(argv[i]);
+        }
+    }
+
+    if (resampler_ids.empty())
+    {
+        resampler_ids.assign(std::begin(l_ResamplerIds), std::end(l_ResamplerIds));
+    }
+
+    for (const std::string& id : resampler_ids)
+    {
+        for (unsigned int requested_frequency : l_RequestedFrequencies)
+        {
+            for (unsigned int dst_freq : l_OutputFrequencies)
+            {
+                benchmark_result result;
+                result.resampler_id = id;
+                result.src_freq = dac_frequency(requested_frequency);
+                result.dst_freq = dst_freq;
+
+                result.throughput = measure_throughput(id.c_str(), result.src_freq, dst_freq, seconds);
+                measure_thd_n(id.c_str(), result.src_freq, dst_freq, &result.thd_n_db, &result.pitch_error_cents);
+                result.aliasing_rejection_db = measure_aliasing_rejection(id.c_str(), result.src_freq, dst_freq);
+                measure_sweep(id.c_str(), result.src_freq, dst_freq, &result.sweep_min_db, &result.sweep_max_db);
+                result.group_delay_ms = measure_group_delay(id.c_str(), result.src_freq, dst_freq);
+
+                results.push_back(result);
+            }
+        }
+    }
+
+    if (json)
+    {
+        print_json(results);
+    }
+    else
+    {
+        print_table(results);
+    }
+
+    return 0;
+}
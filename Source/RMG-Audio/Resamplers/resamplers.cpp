@@ -63,3 +63,13 @@ const struct resampler_interface* get_iresampler(const char* resampler_id, void*
     *resampler = resamplers[i].iresampler->init_from_id(resampler_id);
     return resamplers[i].iresampler;
 }
+
+size_t passthrough_resample(const void* src, size_t src_size, void* dst, size_t dst_size)
+{
+    size_t size = (src_size < dst_size) ? src_size : dst_size;
+
+    memcpy(dst, src, size);
+    memset((char*)dst + size, 0, dst_size - size);
+
+    return size;
+}
@@ -32,13 +32,19 @@ struct resampler_interface
 
     void (*release)(void* resampler);
 
+    /* sets the resampling ratio, only called when src_freq or dst_freq change */
+    void (*configure)(void* resampler, unsigned int src_freq, unsigned int dst_freq);
+
     size_t (*resample)(void* resampler,
-                       const void* src, size_t src_size, unsigned int src_freq,
-                       void* dst, size_t dst_size, unsigned int dst_freq);
+                       const void* src, size_t src_size,
+                       void* dst, size_t dst_size);
 };
 
 const struct resampler_interface* get_iresampler(const char* resampler_id, void** resampler);
 
+/* copies src to dst without resampling, used when src_freq == dst_freq */
+size_t passthrough_resample(const void* src, size_t src_size, void* dst, size_t dst_size);
+
 extern const struct resampler_interface g_trivial_iresampler;
 extern const struct resampler_interface g_speex_iresampler;
 extern const struct resampler_interface g_src_iresampler;
@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 #define CORE_PLUGIN
@@ -36,6 +37,14 @@
 /* assume 2x16bit interleaved channels */
 enum { BYTES_PER_SAMPLE = 4 };
 
+struct speex_resampler
+{
+    SpeexResamplerState* state;
+
+    /* set when src_freq == dst_freq */
+    bool passthrough;
+};
+
 static void* speex_init_from_id(const char* resampler_id)
 {
     size_t i;
@@ -71,40 +80,66 @@ static void* speex_init_from_id(const char* resampler_id)
             resampler_id, types[i]);
     }
 
+    struct speex_resampler* speex_resampler = (struct speex_resampler*)malloc(sizeof(*speex_resampler));
+    if (speex_resampler == NULL) {
+        DebugMessage(M64MSG_ERROR, "Failed to allocate memory for speex resampler");
+        return NULL;
+    }
+
     /* init speex object with dummy frequencies (will be set later) */
-    SpeexResamplerState* spx_state =  speex_resampler_init(2, 44100, 44100, (int)i,  &error);
+    speex_resampler->state = speex_resampler_init(2, 44100, 44100, (int)i,  &error);
+    speex_resampler->passthrough = false;
 
     if (error != RESAMPLER_ERR_SUCCESS) {
         DebugMessage(M64MSG_ERROR, "Speex error: %s", speex_resampler_strerror(error));
+        free(speex_resampler);
+        return NULL;
     }
 
-    return spx_state;
+    return speex_resampler;
 }
 
 static void speex_release(void* resampler)
 {
-    SpeexResamplerState* spx_state = (SpeexResamplerState*)resampler;
+    struct speex_resampler* speex_resampler = (struct speex_resampler*)resampler;
 
-    if (spx_state == NULL) {
+    if (speex_resampler == NULL) {
         return;
     }
 
-    speex_resampler_destroy(spx_state);
+    speex_resampler_destroy(speex_resampler->state);
+    free(speex_resampler);
+}
+
+static void speex_configure(void* resampler, unsigned int src_freq, unsigned int dst_freq)
+{
+    struct speex_resampler* speex_resampler = (struct speex_resampler*)resampler;
+
+    speex_resampler->passthrough = (src_freq == dst_freq);
+
+    /* update resampling rates, this rebuilds the
+     * polyphase filter tables when the ratio changes */
+    int error = speex_resampler_set_rate(speex_resampler->state, src_freq, dst_freq);
+
+    if (error != RESAMPLER_ERR_SUCCESS) {
+        DebugMessage(M64MSG_ERROR, "Speex error: %s", speex_resampler_strerror(error));
+    }
 }
 
 static size_t speex_resample(void* resampler,
-                             const void* src, size_t src_size, unsigned int src_freq,
-                             void* dst, size_t dst_size, unsigned int dst_freq)
+                             const void* src, size_t src_size,
+                             void* dst, size_t dst_size)
 {
-    SpeexResamplerState* spx_state = (SpeexResamplerState*)resampler;
+    struct speex_resampler* speex_resampler = (struct speex_resampler*)resampler;
 
-    /* update resampling rates */
-    speex_resampler_set_rate(spx_state, src_freq, dst_freq);
+    if (speex_resampler->passthrough) {
+        return passthrough_resample(src, src_size, dst, dst_size);
+    }
 
     /* perform resampling */
     spx_uint32_t in_len = src_size / BYTES_PER_SAMPLE;
     spx_uint32_t out_len = dst_size / BYTES_PER_SAMPLE;
-    int error = speex_resampler_process_interleaved_int(spx_state, (const spx_int16_t *)src, &in_len, (spx_int16_t *)dst, &out_len);
+    int error = speex_resampler_process_interleaved_int(speex_resampler->state, (const spx_int16_t *)src, &in_len, (spx_int16_t *)dst, &out_len);
 
     /* in case of error, display error, zero output buffer and discard input buffer */
     if (error != RESAMPLER_ERR_SUCCESS)
@@ -127,5 +162,6 @@ const struct resampler_interface g_speex_iresampler = {
     "speex",
     speex_init_from_id,
     speex_release,
+    speex_configure,
     speex_resample
 };
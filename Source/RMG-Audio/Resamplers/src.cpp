@@ -63,6 +63,12 @@ struct src_resampler
 
     /* 2 intermediate buffers are needed for float/int conversion */
     struct fbuffer fbuffers[2];
+
+    /* dst_freq / src_freq */
+    double ratio;
+
+    /* set when src_freq == dst_freq */
+    bool passthrough;
 };
 
 static void* src_init_from_id(const char* resampler_id)
@@ -134,12 +140,31 @@ static void src_release(void* resampler)
     }
 }
 
+static void src_configure(void* resampler, unsigned int src_freq, unsigned int dst_freq)
+{
+    struct src_resampler* src_resampler = (struct src_resampler*)resampler;
+
+    src_resampler->ratio = (double)dst_freq / src_freq;
+    src_resampler->passthrough = (src_freq == dst_freq);
+
+    /* avoid a ratio transition on the next src_process call */
+    int error = src_set_ratio(src_resampler->state, src_resampler->ratio);
+    if (error) {
+        DebugMessage(M64MSG_ERROR, "SRC error: %s", src_strerror(error));
+    }
+}
+
 static size_t src_resample(void* resampler,
-                           const void* src, size_t src_size, unsigned int src_freq,
-                           void* dst, size_t dst_size, unsigned int dst_freq)
+                           const void* src, size_t src_size,
+                           void* dst, size_t dst_size)
 {
     struct src_resampler* src_resampler = (struct src_resampler*)resampler;
 
+    /* no float conversion needed when the rates are equal */
+    if (src_resampler->passthrough) {
+        return passthrough_resample(src, src_size, dst, dst_size);
+    }
+
     /* High quality resamplers needs more input than what
      * the sample rate ratio would indicate to work properly, hence the src/dst>1 ratio
      *
@@ -168,7 +193,7 @@ static size_t src_resample(void* resampler,
     src_data.data_out = src_resampler->fbuffers[1].data;
     src_data.output_frames = dst_size/4;
 
-    src_data.src_ratio = (float)dst_freq / src_freq;
+    src_data.src_ratio = src_resampler->ratio;
     src_data.end_of_input = 0;
 
     int error = src_process(src_resampler->state, &src_data);
@@ -196,5 +221,6 @@ const struct resampler_interface g_src_iresampler = {
     "src",
     src_init_from_id,
     src_release,
+    src_configure,
     src_resample
 };
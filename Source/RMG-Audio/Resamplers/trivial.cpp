@@ -20,41 +20,96 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include "resamplers.hpp"
+#include "main.hpp"
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
 #define CORE_PLUGIN
 #include <RMG-Core/Core.hpp>
 
+enum { BYTES_PER_SAMPLE = 4 };
+
+struct trivial_resampler
+{
+    unsigned int src_freq;
+    unsigned int dst_freq;
+
+    /* precomputed source sample index for each output sample,
+     * only depends on the ratio so it's reused across calls */
+    uint32_t* indices;
+    /* number of valid entries in indices */
+    size_t indices_count;
+};
+
 static void* trivial_init_from_id(const char* name)
 {
-    /* nothing to do */
-    return nullptr;
+    struct trivial_resampler* trivial_resampler = (struct trivial_resampler*)malloc(sizeof(*trivial_resampler));
+    if (trivial_resampler == NULL) {
+        DebugMessage(M64MSG_ERROR, "Failed to allocate memory for trivial resampler");
+        return NULL;
+    }
+
+    /* lazy-alloc of indices */
+    memset(trivial_resampler, 0, sizeof(*trivial_resampler));
+
+    return trivial_resampler;
 }
 
 static void trivial_release(void* resampler)
 {
-    /* nothing to do */
+    struct trivial_resampler* trivial_resampler = (struct trivial_resampler*)resampler;
+
+    if (trivial_resampler == NULL) {
+        return;
+    }
+
+    free(trivial_resampler->indices);
+    free(trivial_resampler);
+}
+
+static void trivial_configure(void* resampler, unsigned int src_freq, unsigned int dst_freq)
+{
+    struct trivial_resampler* trivial_resampler = (struct trivial_resampler*)resampler;
+
+    if (trivial_resampler->src_freq == src_freq &&
+        trivial_resampler->dst_freq == dst_freq) {
+        return;
+    }
+
+    trivial_resampler->src_freq = src_freq;
+    trivial_resampler->dst_freq = dst_freq;
+
+    /* invalidate the table, it'll be rebuilt on the next resample call */
+    trivial_resampler->indices_count = 0;
 }
 
-static size_t trivial_resample(void* resampler,
-                               const void* src, size_t src_size, unsigned int src_freq,
-                               void* dst, size_t dst_size, unsigned int dst_freq)
+/* builds the source index table for count output samples (+1 for the consumed count) */
+static int trivial_build_indices(struct trivial_resampler* trivial_resampler, size_t count)
 {
-    enum { BYTES_PER_SAMPLE = 4 };
+    const unsigned int src_freq = trivial_resampler->src_freq;
+    const unsigned int dst_freq = trivial_resampler->dst_freq;
     size_t i;
     size_t j = 0;
 
+    uint32_t* indices = (uint32_t*)realloc(trivial_resampler->indices, (count + 1) * sizeof(uint32_t));
+    if (indices == NULL) {
+        return -1;
+    }
+
+    trivial_resampler->indices = indices;
+
     if (dst_freq >= src_freq) {
         const int dpos = 2*src_freq;
         const int dneg = dpos - 2*dst_freq;
 
         int criteria = dpos - dst_freq;
 
-        for (i = 0; i < dst_size/BYTES_PER_SAMPLE; ++i) {
+        for (i = 0; i <= count; ++i) {
 
-            ((uint32_t*)dst)[i] = ((const uint32_t*)src)[j];
+            indices[i] = (uint32_t)j;
 
             if (criteria >= 0) {
                 ++j;
@@ -67,19 +122,53 @@ static size_t trivial_resample(void* resampler,
     }
     else {
         /* Can happen when speed_factor > 1 */
-        for (i = 0; i < dst_size/BYTES_PER_SAMPLE; ++i) {
-
-            j = i * src_freq / dst_freq;
-            ((uint32_t*)dst)[i] = ((const uint32_t*)src)[j];
+        for (i = 0; i <= count; ++i) {
+            indices[i] = (uint32_t)((uint64_t)i * src_freq / dst_freq);
         }
     }
 
-    return j * 4;
+    trivial_resampler->indices_count = count + 1;
+    return 0;
+}
+
+static size_t trivial_resample(void* resampler,
+                               const void* src, size_t src_size,
+                               void* dst, size_t dst_size)
+{
+    struct trivial_resampler* trivial_resampler = (struct trivial_resampler*)resampler;
+    const size_t count = dst_size / BYTES_PER_SAMPLE;
+    size_t i;
+
+    if (trivial_resampler->src_freq == trivial_resampler->dst_freq) {
+        return passthrough_resample(src, src_size, dst, dst_size);
+    }
+
+    if (count + 1 > trivial_resampler->indices_count &&
+        trivial_build_indices(trivial_resampler, count) != 0) {
+        DebugMessage(M64MSG_ERROR, "Failed to allocate memory for trivial resampler");
+        memset(dst, 0, dst_size);
+        return src_size;
+    }
+
+    const uint32_t* indices = trivial_resampler->indices;
+
+    for (i = 0; i < count; ++i) {
+        ((uint32_t*)dst)[i] = ((const uint32_t*)src)[indices[i]];
+    }
+
+    if (trivial_resampler->dst_freq >= trivial_resampler->src_freq) {
+        return indices[count] * BYTES_PER_SAMPLE;
+    }
+    else {
+        /* the downsampling path only consumes up to the last used sample */
+        return (count > 0) ? indices[count - 1] * BYTES_PER_SAMPLE : 0;
+    }
 }
 
 const struct resampler_interface g_trivial_iresampler = {
     "trivial",
     trivial_init_from_id,
     trivial_release,
+    trivial_configure,
     trivial_resample
 };
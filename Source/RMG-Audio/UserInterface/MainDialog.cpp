@@ -29,6 +29,8 @@ MainDialog::MainDialog(QWidget* parent) : QDialog(parent)
     this->resamplerComboBox->setCurrentText(QString::fromStdString(CoreSettingsGetStringValue(SettingsID::Audio_Resampler)));
     this->swapChannelsCheckBox->setChecked(CoreSettingsGetBoolValue(SettingsID::Audio_SwapChannels));
     this->synchronizeAudioCheckBox->setChecked(CoreSettingsGetBoolValue(SettingsID::Audio_Synchronize));
+    this->nativeOutputCheckBox->setChecked(CoreSettingsGetBoolValue(SettingsID::Audio_NativeOutput));
+    this->timeStretchCheckBox->setChecked(CoreSettingsGetBoolValue(SettingsID::Audio_TimeStretch));
 
     if (!CoreIsEmulationRunning() && !CoreIsEmulationPaused())
     {
@@ -92,6 +94,8 @@ void MainDialog::on_buttonBox_clicked(QAbstractButton* button)
         CoreSettingsSetValue(SettingsID::Audio_Resampler, this->resamplerComboBox->currentText().toStdString());
         CoreSettingsSetValue(SettingsID::Audio_SwapChannels, this->swapChannelsCheckBox->isChecked());
         CoreSettingsSetValue(SettingsID::Audio_Synchronize, this->synchronizeAudioCheckBox->isChecked());
+        CoreSettingsSetValue(SettingsID::Audio_NativeOutput, this->nativeOutputCheckBox->isChecked());
+        CoreSettingsSetValue(SettingsID::Audio_TimeStretch, this->timeStretchCheckBox->isChecked());
         CoreSettingsSave();
     }
     else if (pushButton == defaultButton)
@@ -110,6 +114,8 @@ void MainDialog::on_buttonBox_clicked(QAbstractButton* button)
             this->resamplerComboBox->setCurrentText(QString::fromStdString(CoreSettingsGetDefaultStringValue(SettingsID::Audio_Resampler)));
             this->swapChannelsCheckBox->setChecked(CoreSettingsGetDefaultBoolValue(SettingsID::Audio_SwapChannels));
             this->synchronizeAudioCheckBox->setChecked(CoreSettingsGetDefaultBoolValue(SettingsID::Audio_Synchronize));
+            this->nativeOutputCheckBox->setChecked(CoreSettingsGetDefaultBoolValue(SettingsID::Audio_NativeOutput));
+            this->timeStretchCheckBox->setChecked(CoreSettingsGetDefaultBoolValue(SettingsID::Audio_TimeStretch));
         }
     }
 }
@@ -0,0 +1,372 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "capture.hpp"
+#include "telemetry.hpp"
+#include "main.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <SDL_endian.h>
+
+#ifdef CAPTURE_FLAC
+#include <FLAC/stream_encoder.h>
+#endif
+
+//
+// Local Defines
+//
+
+/* assume 2x16bit interleaved channels */
+#define BYTES_PER_FRAME 4
+
+/* size of the queue in frames, must be a power of 2,
+ * holds ~2.7 seconds of audio at 48khz */
+#define QUEUE_FRAMES (1 << 17)
+
+/* amount of frames the writer thread handles at once */
+#define WRITER_CHUNK_FRAMES 4096
+
+/* how long the writer thread sleeps when the queue is empty */
+#define WRITER_SLEEP_MS 10
+
+#define WAV_HEADER_SIZE 44
+
+//
+// Local Structures
+//
+
+struct capture
+{
+    /* single producer (audio callback),
+     * single consumer (writer thread) queue */
+    uint32_t* queue;
+    std::atomic<uint64_t> write_position;
+    std::atomic<uint64_t> read_position;
+
+    std::atomic<bool> running;
+    std::thread writer_thread;
+    /* serializes capture_start() and capture_stop(),
+     * they're called from the UI and emulation threads */
+    std::mutex control_mutex;
+
+    unsigned int frequency;
+    uint64_t written_frames;
+    /* only modified by the producer */
+    uint64_t dropped_frames;
+
+    FILE* file;
+#ifdef CAPTURE_FLAC
+    FLAC__StreamEncoder* encoder;
+#endif
+};
+
+//
+// Local Functions
+//
+
+static void write_u16(unsigned char* dst, uint16_t value)
+{
+    dst[0] = value & 0xff;
+    dst[1] = (value >> 8) & 0xff;
+}
+
+static void write_u32(unsigned char* dst, uint32_t value)
+{
+    write_u16(dst, value & 0xffff);
+    write_u16(dst + 2, value >> 16);
+}
+
+static void write_wav_header(FILE* file, unsigned int frequency, uint64_t frames)
+{
+    unsigned char header[WAV_HEADER_SIZE];
+    /* the sizes are 32bit, clamp them for very long captures */
+    uint32_t data_size = (uint32_t)std::min<uint64_t>(frames * BYTES_PER_FRAME, UINT32_MAX - WAV_HEADER_SIZE);
+
+    memcpy(header, "RIFF", 4);
+    write_u32(header + 4, data_size + WAV_HEADER_SIZE - 8);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    write_u32(header + 16, 16);
+    write_u16(header + 20, 1); /* PCM */
+    write_u16(header + 22, 2); /* channels */
+    write_u32(header + 24, frequency);
+    write_u32(header + 28, frequency * BYTES_PER_FRAME);
+    write_u16(header + 32, BYTES_PER_FRAME);
+    write_u16(header + 34, 16); /* bits per sample */
+    memcpy(header + 36, "data", 4);
+    write_u32(header + 40, data_size);
+
+    fseek(file, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), file);
+}
+
+static int open_output(struct capture* capture, const char* path)
+{
+#ifdef CAPTURE_FLAC
+    capture->encoder = FLAC__stream_encoder_new();
+    if (capture->encoder == nullptr)
+    {
+        return -1;
+    }
+
+    FLAC__stream_encoder_set_channels(capture->encoder, 2);
+    FLAC__stream_encoder_set_bits_per_sample(capture->encoder, 16);
+    FLAC__stream_encoder_set_sample_rate(capture->encoder, capture->frequency);
+    FLAC__stream_encoder_set_compression_level(capture->encoder, 5);
+
+    if (FLAC__stream_encoder_init_file(capture->encoder, path, nullptr, nullptr) != FLAC__STREAM_ENCODER_INIT_STATUS_OK)
+    {
+        FLAC__stream_encoder_delete(capture->encoder);
+        capture->encoder = nullptr;
+        return -1;
+    }
+#else
+    capture->file = fopen(path, "wb");
+    if (capture->file == nullptr)
+    {
+        return -1;
+    }
+
+    /* the sizes are written when closing the file */
+    write_wav_header(capture->file, capture->frequency, 0);
+#endif
+    return 0;
+}
+
+static void write_output(struct capture* capture, const uint32_t* frames, size_t count)
+{
+#ifdef CAPTURE_FLAC
+    FLAC__int32 samples[WRITER_CHUNK_FRAMES * 2];
+    const int16_t* src = (const int16_t*)frames;
+
+    for (size_t i = 0; i < count * 2; i++)
+    {
+        samples[i] = src[i];
+    }
+
+    FLAC__stream_encoder_process_interleaved(capture->encoder, samples, (uint32_t)count);
+#else
+    /* the queue holds native endian samples, WAV is little endian */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    uint32_t swapped[WRITER_CHUNK_FRAMES];
+    for (size_t i = 0; i < count; i++)
+    {
+        swapped[i] = ((frames[i] & 0x00ff00ff) << 8) | ((frames[i] >> 8) & 0x00ff00ff);
+    }
+    frames = swapped;
+#endif
+    fwrite(frames, BYTES_PER_FRAME, count, capture->file);
+#endif
+    capture->written_frames += count;
+}
+
+static void close_output(struct capture* capture)
+{
+#ifdef CAPTURE_FLAC
+    FLAC__stream_encoder_finish(capture->encoder);
+    FLAC__stream_encoder_delete(capture->encoder);
+    capture->encoder = nullptr;
+#else
+    write_wav_header(capture->file, capture->frequency, capture->written_frames);
+    fclose(capture->file);
+    capture->file = nullptr;
+#endif
+}
+
+static void copy_frames(uint32_t* dst, const uint32_t* src, size_t frames, bool swap_channels)
+{
+    if (!swap_channels)
+    {
+        memcpy(dst, src, frames * BYTES_PER_FRAME);
+        return;
+    }
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        dst[i] = (src[i] << 16) | (src[i] >> 16);
+    }
+}
+
+static size_t pop_frames(struct capture* capture, uint32_t* dst, size_t frames)
+{
+    uint64_t read = capture->read_position.load(std::memory_order_relaxed);
+    uint64_t write = capture->write_position.load(std::memory_order_acquire);
+    size_t count = std::min<size_t>(frames, write - read);
+    size_t offset = read & (QUEUE_FRAMES - 1);
+    size_t first = std::min<size_t>(count, QUEUE_FRAMES - offset);
+
+    memcpy(dst, capture->queue + offset, first * BYTES_PER_FRAME);
+    memcpy(dst + first, capture->queue, (count - first) * BYTES_PER_FRAME);
+
+    capture->read_position.store(read + count, std::memory_order_release);
+    return count;
+}
+
+static void writer_thread(struct capture* capture)
+{
+    uint32_t chunk[WRITER_CHUNK_FRAMES];
+
+    while (true)
+    {
+        /* check before draining, so everything pushed
+         * before capture_stop() is written */
+        bool running = capture->running.load(std::memory_order_acquire);
+
+        size_t count = pop_frames(capture, chunk, WRITER_CHUNK_FRAMES);
+        if (count > 0)
+        {
+            write_output(capture, chunk, count);
+            continue;
+        }
+
+        if (!running)
+        {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_SLEEP_MS));
+    }
+}
+
+static void stop_capture(struct capture* capture)
+{
+    /* only the caller which clears the flag joins the writer thread */
+    if (!capture->running.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    capture->writer_thread.join();
+
+    close_output(capture);
+
+    DebugMessage(M64MSG_INFO, "Stopped audio capture: wrote %llu frames, dropped %llu frames",
+        (unsigned long long)capture->written_frames, (unsigned long long)capture->dropped_frames);
+}
+
+//
+// Exported Functions
+//
+
+struct capture* init_capture(void)
+{
+    struct capture* capture = new struct capture();
+
+    capture->queue = (uint32_t*)malloc(QUEUE_FRAMES * BYTES_PER_FRAME);
+    if (capture->queue == nullptr)
+    {
+        delete capture;
+        return nullptr;
+    }
+
+    return capture;
+}
+
+void release_capture(struct capture* capture)
+{
+    if (capture == nullptr)
+    {
+        return;
+    }
+
+    capture_stop(capture);
+
+    free(capture->queue);
+    delete capture;
+}
+
+const char* capture_file_extension(void)
+{
+#ifdef CAPTURE_FLAC
+    return ".flac";
+#else
+    return ".wav";
+#endif
+}
+
+int capture_start(struct capture* capture, const char* path, unsigned int frequency)
+{
+    std::lock_guard<std::mutex> lock(capture->control_mutex);
+
+    stop_capture(capture);
+
+    capture->frequency = frequency;
+    capture->written_frames = 0;
+    capture->dropped_frames = 0;
+    capture->write_position.store(0, std::memory_order_relaxed);
+    capture->read_position.store(0, std::memory_order_relaxed);
+
+    if (open_output(capture, path) != 0)
+    {
+        DebugMessage(M64MSG_ERROR, "Failed to open audio capture file: %s", path);
+        return -1;
+    }
+
+    capture->running.store(true, std::memory_order_release);
+    capture->writer_thread = std::thread(writer_thread, capture);
+
+    DebugMessage(M64MSG_INFO, "Started audio capture: %s", path);
+    return 0;
+}
+
+void capture_stop(struct capture* capture)
+{
+    std::lock_guard<std::mutex> lock(capture->control_mutex);
+
+    stop_capture(capture);
+}
+
+unsigned int capture_is_running(const struct capture* capture)
+{
+    return capture->running.load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+unsigned int capture_frequency(const struct capture* capture)
+{
+    return capture->frequency;
+}
+
+void capture_push(struct capture* capture, const void* src, size_t frames, bool swap_channels)
+{
+    if (!capture->running.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    uint64_t write = capture->write_position.load(std::memory_order_relaxed);
+    uint64_t read = capture->read_position.load(std::memory_order_acquire);
+    size_t count = std::min<size_t>(frames, QUEUE_FRAMES - (write - read));
+    size_t offset = write & (QUEUE_FRAMES - 1);
+    size_t first = std::min<size_t>(count, QUEUE_FRAMES - offset);
+
+    if (src != nullptr)
+    {
+        copy_frames(capture->queue + offset, (const uint32_t*)src, first, swap_channels);
+        copy_frames(capture->queue, (const uint32_t*)src + first, count - first, swap_channels);
+    }
+    else
+    {
+        memset(capture->queue + offset, 0, first * BYTES_PER_FRAME);
+        memset(capture->queue, 0, (count - first) * BYTES_PER_FRAME);
+    }
+
+    capture->write_position.store(write + count, std::memory_order_release);
+
+    if (count < frames)
+    {
+        capture->dropped_frames += frames - count;
+        telemetry_count(TELEMETRY_CAPTURE_DROPPED_FRAMES, frames - count);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef M64P_CAPTURE_H
+#define M64P_CAPTURE_H
+
+#include <cstdlib>
+#include <cstdint>
+
+/* records interleaved 16bit stereo samples to a WAV file,
+ * or a FLAC file when built with libFLAC.
+ *
+ * samples are pushed from the audio callback into a fixed size
+ * lock-free queue, which is drained by a writer thread, samples
+ * which don't fit in the queue are dropped and counted */
+struct capture;
+
+struct capture* init_capture(void);
+
+void release_capture(struct capture* capture);
+
+/* returns the file extension (including the dot) of the captured files */
+const char* capture_file_extension(void);
+
+/* starts writing to path, must not be called
+ * concurrently with capture_push(), returns 0 on success */
+int capture_start(struct capture* capture, const char* path, unsigned int frequency);
+
+/* stops the writer thread after it has written all queued samples */
+void capture_stop(struct capture* capture);
+
+unsigned int capture_is_running(const struct capture* capture);
+
+unsigned int capture_frequency(const struct capture* capture);
+
+/* queues frames for writing, optionally swapping the left and right channels,
+ * src may be NULL for silence, never blocks */
+void capture_push(struct capture* capture, const void* src, size_t frames, bool swap_channels);
+
+#endif // M64P_CAPTURE_H
@@ -26,12 +26,15 @@
 #include <SDL_audio.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <mutex>
 
 #include "RMG-Core/Settings/Settings.hpp"
 #include "RMG-Core/Settings/SettingsID.hpp"
 #include "main.hpp"
 
 #include "sdl_backend.hpp"
+#include "telemetry.hpp"
+#include "mixer.hpp"
 #include "Resamplers/resamplers.hpp"
 
 #define M64P_PLUGIN_PROTOTYPES 1
@@ -45,16 +48,17 @@
 #define AUDIO_PLUGIN_API_VERSION 0x020000
 #define CONFIG_PARAM_VERSION     1.00
 
-#if SDL_VERSION_ATLEAST(2,0,0)
-#define SDL_MixAudio(A, B, C, D) SDL_MixAudioFormat(A, B, AUDIO_S16SYS, C, D)
-#endif
-
 /* local variables */
 static void (*l_DebugCallback)(void *, int, const char *) = nullptr;
 static void *l_DebugCallContext = nullptr;
 static int l_PluginInit = 0;
 
 static struct sdl_backend* l_sdl_backend = nullptr;
+/* guards creating and releasing l_sdl_backend against the
+ * audio capture functions, which are called from the UI thread,
+ * the other functions run on the emulation thread like RomOpen()
+ * and RomClosed() so they don't need to lock */
+static std::mutex l_sdl_backend_mutex;
 
 /* Read header for type definition */
 static AUDIO_INFO AudioInfo;
@@ -191,6 +195,67 @@ EXPORT m64p_error CALL PluginConfig(void)
     return M64ERR_SUCCESS;
 }
 
+EXPORT m64p_error CALL PluginGetAudioStatistics(m64p_audio_statistics* statistics)
+{
+    if (!l_PluginInit)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    if (statistics == nullptr)
+    {
+        return M64ERR_INPUT_ASSERT;
+    }
+
+    telemetry_get(statistics);
+    return M64ERR_SUCCESS;
+}
+
+EXPORT m64p_error CALL PluginStartAudioCapture(const char* path)
+{
+    if (!l_PluginInit)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    if (path == nullptr)
+    {
+        return M64ERR_INPUT_ASSERT;
+    }
+
+    std::lock_guard<std::mutex> lock(l_sdl_backend_mutex);
+
+    if (l_sdl_backend == nullptr)
+    {
+        return M64ERR_INVALID_STATE;
+    }
+
+    if (sdl_start_capture(l_sdl_backend, path) != 0)
+    {
+        return M64ERR_FILES;
+    }
+
+    return M64ERR_SUCCESS;
+}
+
+EXPORT m64p_error CALL PluginStopAudioCapture(void)
+{
+    if (!l_PluginInit)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    std::lock_guard<std::mutex> lock(l_sdl_backend_mutex);
+
+    if (l_sdl_backend == nullptr)
+    {
+        return M64ERR_INVALID_STATE;
+    }
+
+    sdl_stop_capture(l_sdl_backend);
+    return M64ERR_SUCCESS;
+}
+
 /* ----------- Audio Functions ------------- */
 static unsigned int vi_clock_from_system_type(int system_type)
 {
@@ -244,6 +309,7 @@ EXPORT int CALL RomOpen(void)
     if (!l_PluginInit || l_sdl_backend != nullptr)
         return 0;
 
+    std::lock_guard<std::mutex> lock(l_sdl_backend_mutex);
     l_sdl_backend = init_sdl_backend();
     return 1;
 }
@@ -253,6 +319,12 @@ EXPORT void CALL RomClosed(void)
     if (!l_PluginInit)
         return;
 
+    if (l_sdl_backend != nullptr)
+    {
+        telemetry_dump();
+    }
+
+    std::lock_guard<std::mutex> lock(l_sdl_backend_mutex);
     release_sdl_backend(l_sdl_backend);
     l_sdl_backend = nullptr;
 }
@@ -271,14 +343,23 @@ EXPORT void CALL SetSpeedFactor(int percentage)
 
 size_t ResampleAndMix(void* resampler, const struct resampler_interface* iresampler,
         void* mix_buffer,
-        const void* src, size_t src_size, unsigned int src_freq,
-        void* dst, size_t dst_size, unsigned int dst_freq)
+        const void* src, size_t src_size,
+        void* dst, size_t dst_frames, unsigned int dst_float,
+        unsigned int swap_channels)
 {
     size_t consumed;
 
-    consumed = iresampler->resample(resampler, src, src_size, src_freq, mix_buffer, dst_size, dst_freq);
-    memset(dst, 0, dst_size);
-    SDL_MixAudio((Uint8*)dst, (Uint8*)mix_buffer, dst_size, VolSDL);
+    consumed = iresampler->resample(resampler, src, src_size, mix_buffer, dst_frames * 4);
+
+    /* channel swap, volume, mixing and format conversion are done in a single pass */
+    if (dst_float)
+    {
+        mix_samples_f32(dst, mix_buffer, dst_frames, VolSDL, swap_channels != 0);
+    }
+    else
+    {
+        mix_samples(dst, mix_buffer, dst_frames, VolSDL, swap_channels != 0);
+    }
 
     return consumed;
 }
@@ -0,0 +1,333 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mixer.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MIXER_SSE2
+#endif
+
+#if defined(MIXER_SSE2) && defined(__GNUC__)
+#include <immintrin.h>
+#define MIXER_AVX2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MIXER_NEON
+#endif
+
+struct mix_kernel
+{
+    void (*mix)(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels);
+    void (*mix_f32)(float* dst, const int16_t* src, size_t frames, float scale, bool swap_channels);
+    const char* name;
+};
+
+//
+// Local Functions
+//
+
+static inline int16_t mix_sample(int16_t sample, int volume)
+{
+    /* integer division truncates towards zero, just like SDL's ADJUST_VOLUME */
+    int32_t value = ((int32_t)sample * volume) / MIXER_MAX_VOLUME;
+
+    if (value > INT16_MAX)
+    {
+        value = INT16_MAX;
+    }
+    else if (value < INT16_MIN)
+    {
+        value = INT16_MIN;
+    }
+
+    return (int16_t)value;
+}
+
+static void mix_samples_scalar(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels)
+{
+    const size_t swap = swap_channels ? 1 : 0;
+
+    for (size_t i = 0; i < frames * 2; i++)
+    {
+        dst[i] = mix_sample(src[i ^ swap], volume);
+    }
+}
+
+static void mix_samples_f32_scalar(float* dst, const int16_t* src, size_t frames, float scale, bool swap_channels)
+{
+    const size_t swap = swap_channels ? 1 : 0;
+
+    for (size_t i = 0; i < frames * 2; i++)
+    {
+        dst[i] = (float)src[i ^ swap] * scale;
+    }
+}
+
+#ifdef MIXER_SSE2
+static inline __m128i mix_sse2_adjust_volume(__m128i samples, __m128i volume, __m128i bias)
+{
+    /* samples are interleaved with zeroes and volume is (volume, 0) pairs,
+     * so madd results in a sign extended sample * volume per 32bit lane */
+    __m128i value = _mm_madd_epi16(samples, volume);
+    /* round towards zero like the scalar division does */
+    value = _mm_add_epi32(value, _mm_and_si128(_mm_srai_epi32(value, 31), bias));
+    return _mm_srai_epi32(value, 7);
+}
+
+static void mix_samples_sse2(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vol  = _mm_set1_epi32(volume);
+    const __m128i bias = _mm_set1_epi32(MIXER_MAX_VOLUME - 1);
+    size_t i = 0;
+
+    for (; i + 4 <= frames; i += 4)
+    {
+        __m128i samples = _mm_loadu_si128((const __m128i*)(src + i * 2));
+
+        if (swap_channels)
+        {
+            samples = _mm_shufflelo_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+            samples = _mm_shufflehi_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+
+        __m128i lo = mix_sse2_adjust_volume(_mm_unpacklo_epi16(samples, zero), vol, bias);
+        __m128i hi = mix_sse2_adjust_volume(_mm_unpackhi_epi16(samples, zero), vol, bias);
+
+        _mm_storeu_si128((__m128i*)(dst + i * 2), _mm_packs_epi32(lo, hi));
+    }
+
+    mix_samples_scalar(dst + i * 2, src + i * 2, frames - i, volume, swap_channels);
+}
+
+static void mix_samples_f32_sse2(float* dst, const int16_t* src, size_t frames, float scale, bool swap_channels)
+{
+    const __m128 vscale = _mm_set1_ps(scale);
+    size_t i = 0;
+
+    for (; i + 4 <= frames; i += 4)
+    {
+        __m128i samples = _mm_loadu_si128((const __m128i*)(src + i * 2));
+
+        if (swap_channels)
+        {
+            samples = _mm_shufflelo_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+            samples = _mm_shufflehi_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+
+        /* sign extend to 32bit by unpacking into the high half and shifting back */
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+
+        _mm_storeu_ps(dst + i * 2, _mm_mul_ps(_mm_cvtepi32_ps(lo), vscale));
+        _mm_storeu_ps(dst + i * 2 + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), vscale));
+    }
+
+    mix_samples_f32_scalar(dst + i * 2, src + i * 2, frames - i, scale, swap_channels);
+}
+#endif // MIXER_SSE2
+
+#ifdef MIXER_AVX2
+__attribute__((target("avx2")))
+static void mix_samples_avx2(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vol  = _mm256_set1_epi32(volume);
+    const __m256i bias = _mm256_set1_epi32(MIXER_MAX_VOLUME - 1);
+    size_t i = 0;
+
+    for (; i + 8 <= frames; i += 8)
+    {
+        __m256i samples = _mm256_loadu_si256((const __m256i*)(src + i * 2));
+
+        if (swap_channels)
+        {
+            samples = _mm256_shufflelo_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+            samples = _mm256_shufflehi_epi16(samples, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+
+        /* unpack and pack both operate per 128bit lane,
+         * so the sample order is preserved */
+        __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(samples, zero), vol);
+        __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(samples, zero), vol);
+
+        lo = _mm256_add_epi32(lo, _mm256_and_si256(_mm256_srai_epi32(lo, 31), bias));
+        hi = _mm256_add_epi32(hi, _mm256_and_si256(_mm256_srai_epi32(hi, 31), bias));
+
+        lo = _mm256_srai_epi32(lo, 7);
+        hi = _mm256_srai_epi32(hi, 7);
+
+        _mm256_storeu_si256((__m256i*)(dst + i * 2), _mm256_packs_epi32(lo, hi));
+    }
+
+    mix_samples_sse2(dst + i * 2, src + i * 2, frames - i, volume, swap_channels);
+}
+#endif // MIXER_AVX2
+
+#ifdef MIXER_NEON
+static inline int32x4_t mix_neon_round(int32x4_t value, int32x4_t bias)
+{
+    /* round towards zero like the scalar division does */
+    value = vaddq_s32(value, vandq_s32(vshrq_n_s32(value, 31), bias));
+    return vshrq_n_s32(value, 7);
+}
+
+static void mix_samples_neon(int16_t* dst, const int16_t* src, size_t frames, int volume, bool swap_channels)
+{
+    const int32x4_t bias = vdupq_n_s32(MIXER_MAX_VOLUME - 1);
+    size_t i = 0;
+
+    for (; i + 4 <= frames; i += 4)
+    {
+        int16x8_t samples = vld1q_s16(src + i * 2);
+
+        if (swap_channels)
+        {
+            samples = vrev32q_s16(samples);
+        }
+
+        int32x4_t lo = mix_neon_round(vmull_n_s16(vget_low_s16(samples), (int16_t)volume), bias);
+        int32x4_t hi = mix_neon_round(vmull_n_s16(vget_high_s16(samples), (int16_t)volume), bias);
+
+        vst1q_s16(dst + i * 2, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+
+    mix_samples_scalar(dst + i * 2, src + i * 2, frames - i, volume, swap_channels);
+}
+
+static void mix_samples_f32_neon(float* dst, const int16_t* src, size_t frames, float scale, bool swap_channels)
+{
+    size_t i = 0;
+
+    for (; i + 4 <= frames; i += 4)
+    {
+        int16x8_t samples = vld1q_s16(src + i * 2);
+
+        if (swap_channels)
+        {
+            samples = vrev32q_s16(samples);
+        }
+
+        float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+        float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+
+        vst1q_f32(dst + i * 2, vmulq_n_f32(lo, scale));
+        vst1q_f32(dst + i * 2 + 4, vmulq_n_f32(hi, scale));
+    }
+
+    mix_samples_f32_scalar(dst + i * 2, src + i * 2, frames - i, scale, swap_channels);
+}
+#endif // MIXER_NEON
+
+static const struct mix_kernel l_kernels[] =
+{
+    { mix_samples_scalar, mix_samples_f32_scalar, "scalar" },
+#ifdef MIXER_SSE2
+    { mix_samples_sse2, mix_samples_f32_sse2, "sse2" },
+#endif // MIXER_SSE2
+#ifdef MIXER_AVX2
+    { mix_samples_avx2, mix_samples_f32_sse2, "avx2" },
+#endif // MIXER_AVX2
+#ifdef MIXER_NEON
+    { mix_samples_neon, mix_samples_f32_neon, "neon" },
+#endif // MIXER_NEON
+};
+
+static size_t supported_kernel_count(void)
+{
+    size_t count = sizeof(l_kernels) / sizeof(l_kernels[0]);
+
+#ifdef MIXER_AVX2
+    /* the avx2 kernel is always the last one */
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        count--;
+    }
+#endif // MIXER_AVX2
+
+    return count;
+}
+
+static const struct mix_kernel*& selected_kernel(void)
+{
+    /* the fastest supported kernel is the last one */
+    static const struct mix_kernel* selected = &l_kernels[supported_kernel_count() - 1];
+    return selected;
+}
+
+//
+// Exported Functions
+//
+
+void mix_samples(void* dst, const void* src, size_t frames, int volume, bool swap_channels)
+{
+    const struct mix_kernel* selected = selected_kernel();
+
+    if (volume <= 0)
+    {
+        memset(dst, 0, frames * 4);
+        return;
+    }
+
+    if (volume > MIXER_MAX_VOLUME)
+    {
+        volume = MIXER_MAX_VOLUME;
+    }
+
+    if (volume == MIXER_MAX_VOLUME && !swap_channels)
+    {
+        memcpy(dst, src, frames * 4);
+        return;
+    }
+
+    selected->mix((int16_t*)dst, (const int16_t*)src, frames, volume, swap_channels);
+}
+
+void mix_samples_f32(void* dst, const void* src, size_t frames, int volume, bool swap_channels)
+{
+    if (volume < 0)
+    {
+        volume = 0;
+    }
+    else if (volume > MIXER_MAX_VOLUME)
+    {
+        volume = MIXER_MAX_VOLUME;
+    }
+
+    const float scale = ((float)volume / MIXER_MAX_VOLUME) / 32768.0f;
+
+    selected_kernel()->mix_f32((float*)dst, (const int16_t*)src, frames, scale, swap_channels);
+}
+
+const char* mix_samples_kernel_name(void)
+{
+    return selected_kernel()->name;
+}
+
+size_t mix_samples_kernel_count(void)
+{
+    return supported_kernel_count();
+}
+
+bool mix_samples_select_kernel(size_t index)
+{
+    if (index >= supported_kernel_count())
+    {
+        return false;
+    }
+
+    selected_kernel() = &l_kernels[index];
+    return true;
+}
@@ -0,0 +1,43 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef M64P_MIXER_H
+#define M64P_MIXER_H
+
+#include <cstdlib>
+
+/* maximum volume passed to mix_samples, matches SDL_MIX_MAXVOLUME */
+#define MIXER_MAX_VOLUME 128
+
+/* Writes 'frames' interleaved 16bit stereo frames from src to dst,
+ * optionally swapping the left and right channels, scaling them by
+ * volume / MIXER_MAX_VOLUME (volume ranges from 0 to MIXER_MAX_VOLUME)
+ * and saturating the result.
+ *
+ * The output is bit-exact with a memset of dst followed by
+ * SDL_MixAudioFormat(dst, src, AUDIO_S16SYS, frames * 4, volume)
+ * on a channel swapped src, but done in a single pass */
+void mix_samples(void* dst, const void* src, size_t frames, int volume, bool swap_channels);
+
+/* same as mix_samples() but writes 32bit float frames to dst,
+ * used when the audio device is opened with a float format */
+void mix_samples_f32(void* dst, const void* src, size_t frames, int volume, bool swap_channels);
+
+/* returns the name of the mixing kernel selected at runtime */
+const char* mix_samples_kernel_name(void);
+
+/* returns the amount of mixing kernels supported by the cpu */
+size_t mix_samples_kernel_count(void);
+
+/* selects the mixing kernel used by mix_samples() and mix_samples_f32(),
+ * only meant for the mixer check, which compares every kernel,
+ * returns false when index is out of range */
+bool mix_samples_select_kernel(size_t index);
+
+#endif // M64P_MIXER_H
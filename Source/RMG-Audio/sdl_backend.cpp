@@ -28,6 +28,10 @@
 #include "RMG-Core/Settings/SettingsID.hpp"
 #include "circular_buffer.hpp"
 #include "Resamplers/resamplers.hpp"
+#include "time_stretch.hpp"
+#include "telemetry.hpp"
+#include "capture.hpp"
+#include "mixer.hpp"
 #include "main.hpp"
 
 #define M64P_PLUGIN_PROTOTYPES 1
@@ -36,6 +40,7 @@
 
 /* number of bytes per sample */
 #define N64_SAMPLE_BYTES 4
+/* mix buffer samples are always 16bit, regardless of the output format */
 #define SDL_SAMPLE_BYTES 4
 
 #define SDL_LockAudio() SDL_LockAudioDevice(sdl_backend->device)
@@ -72,15 +77,37 @@ struct sdl_backend
 
     unsigned int audio_sync;
 
+    /* Open the device at its native frequency instead of one based on input_frequency */
+    unsigned int native_output;
+
+    /* Obtained output format is float */
+    unsigned int float_output;
+
+    /* Number of bytes per output sample, depends on the obtained format */
+    unsigned int output_sample_bytes;
+
     unsigned int paused_for_sync;
 
-    unsigned int underrun_count;
+    /* SDL_GetPerformanceFrequency(), used for telemetry */
+    uint64_t performance_frequency;
 
     unsigned int error;
 
     /* Resampler */
     void* resampler;
     const struct resampler_interface* iresampler;
+
+    /* Time stretcher, used instead of resampling
+     * for the speed factor when enabled */
+    unsigned int time_stretch_enabled;
+    struct time_stretch* time_stretch;
+
+    /* Audio capture, fed with the resampled samples */
+    struct capture* capture;
+
+    /* Remainder of the emulated time published to the metrics,
+     * in microseconds multiplied by input_frequency */
+    uint64_t emulated_time_remainder;
 };
 
 /* SDL_AudioFormat.format format specifier and args builder */
@@ -91,33 +118,126 @@ struct sdl_backend
         SDL_AUDIO_ISBIGENDIAN(x) ? "BE" : "LE"
 
 
+/* Confusing logic but, for LittleEndian host copying the samples as-is will result in swapped channels,
+ * whereas swapping them will result in non-swapped channels.
+ * For BigEndian host this logic is inverted, copying will result in non swapped channels
+ * and swapping will result in swapped channels.
+ *
+ * This is due to the fact that the core stores 32bit words in native order in RDRAM.
+ * For instance N64 bytes "Lh Ll Rh Rl" will be stored as "Rl Rh Ll Lh" on LittleEndian host
+ * and therefore should be swapped to get non swapped channels,
+ * whereas on BigEndian host the bytes will be stored as "Lh Ll Rh Rl" and therefore
+ * copying results in the non-swapped channels outcome.
+ *
+ * Resampling is done per channel, so swapping after resampling gives the same result.
+ */
+static unsigned int output_swap_channels(const struct sdl_backend* sdl_backend)
+{
+    return !(sdl_backend->swap_channels ^ (SDL_BYTEORDER == SDL_BIG_ENDIAN));
+}
+
+static unsigned int is_time_stretching(const struct sdl_backend* sdl_backend)
+{
+    return sdl_backend->time_stretch_enabled && sdl_backend->speed_factor != 100;
+}
+
+/* output frequency of the resampler, the speed factor is applied
+ * by resampling unless the time stretcher takes care of it */
+static unsigned int resampler_output_frequency(const struct sdl_backend* sdl_backend)
+{
+    if (is_time_stretching(sdl_backend))
+    {
+        return sdl_backend->output_frequency;
+    }
+
+    return sdl_backend->output_frequency * 100 / sdl_backend->speed_factor;
+}
+
+static void configure_resampler(struct sdl_backend* sdl_backend)
+{
+    SDL_LockAudio();
+    sdl_backend->iresampler->configure(sdl_backend->resampler,
+            sdl_backend->input_frequency, resampler_output_frequency(sdl_backend));
+    if (is_time_stretching(sdl_backend))
+    {
+        time_stretch_configure(sdl_backend->time_stretch,
+            sdl_backend->input_frequency, sdl_backend->speed_factor);
+    }
+    SDL_UnlockAudio();
+}
+
 static void my_audio_callback(void* userdata, unsigned char* stream, int len)
 {
     struct sdl_backend* sdl_backend = (struct sdl_backend*)userdata;
+    unsigned int now = SDL_GetTicks();
+
+    telemetry_count(TELEMETRY_CALLBACKS, 1);
+    if (sdl_backend->last_cb_time != 0)
+    {
+        telemetry_record(TELEMETRY_CALLBACK_INTERVAL_MS, now - sdl_backend->last_cb_time);
+    }
 
     /* mark the time, for synchronization on the input side */
-    sdl_backend->last_cb_time = SDL_GetTicks();
+    sdl_backend->last_cb_time = now;
 
-    unsigned int newsamplerate = sdl_backend->output_frequency * 100 / sdl_backend->speed_factor;
+    unsigned int newsamplerate = resampler_output_frequency(sdl_backend);
     unsigned int oldsamplerate = sdl_backend->input_frequency;
-    size_t needed = (len * oldsamplerate) / newsamplerate;
+    size_t frames = len / sdl_backend->output_sample_bytes;
+    size_t needed = (frames * N64_SAMPLE_BYTES * oldsamplerate) / newsamplerate;
     size_t available;
     size_t consumed;
+    unsigned int time_stretching = is_time_stretching(sdl_backend);
 
     const void* src = cbuff_tail(&sdl_backend->primary_buffer, &available);
+
+    const uint32_t buffer_fill_ms = (uint32_t)(((uint64_t)(available / N64_SAMPLE_BYTES) * 1000 * 100) / ((uint64_t)oldsamplerate * sdl_backend->speed_factor));
+    telemetry_record(TELEMETRY_PRIMARY_BUFFER_FILL_MS, buffer_fill_ms);
+    CoreMetricsSet(CoreMetric::AudioBufferFill, buffer_fill_ms);
+
+    if (time_stretching)
+    {
+        /* stretch the primary buffer into the time stretch output,
+         * the resampler reads from that instead */
+        consumed = time_stretch_process(sdl_backend->time_stretch, src, available, needed);
+        consume_cbuff_data(&sdl_backend->primary_buffer, consumed);
+
+        src = time_stretch_output(sdl_backend->time_stretch, &available);
+    }
+
     if ((available > 0) && (available >= needed))
     {
+        uint64_t start = SDL_GetPerformanceCounter();
+
         consumed = ResampleAndMix(sdl_backend->resampler, sdl_backend->iresampler,
                 sdl_backend->mix_buffer,
-                src, available, oldsamplerate,
-                stream, len, newsamplerate);
+                src, available,
+                stream, frames, sdl_backend->float_output,
+                output_swap_channels(sdl_backend));
 
-        consume_cbuff_data(&sdl_backend->primary_buffer, consumed);
+        telemetry_record(TELEMETRY_RESAMPLE_TIME_US,
+            (uint32_t)(((SDL_GetPerformanceCounter() - start) * 1000000) / sdl_backend->performance_frequency));
+
+        /* mix_buffer holds the resampled samples before volume and channel swapping */
+        capture_push(sdl_backend->capture, sdl_backend->mix_buffer, frames,
+            output_swap_channels(sdl_backend) != 0);
+
+        if (time_stretching)
+        {
+            time_stretch_consume(sdl_backend->time_stretch, consumed);
+        }
+        else
+        {
+            consume_cbuff_data(&sdl_backend->primary_buffer, consumed);
+        }
     }
     else
     {
-        ++sdl_backend->underrun_count;
+        telemetry_count(TELEMETRY_UNDERRUNS, 1);
+        CoreMetricsAdd(CoreMetric::AudioUnderruns, 1);
         memset(stream, 0, len);
+
+        /* keep the capture in sync with the output */
+        capture_push(sdl_backend->capture, nullptr, frames, false);
     }
 }
 
@@ -127,6 +247,7 @@ static size_t new_primary_buffer_size(const struct sdl_backend* sdl_backend)
         (sdl_backend->output_frequency * 100);
 }
 
+/* SDL_LockAudio is recursive, so callers may already hold the lock */
 static void resize_primary_buffer(struct sdl_backend* sdl_backend, size_t new_size)
 {
     /* only grows the buffer */
@@ -146,6 +267,70 @@ static unsigned int select_output_frequency(unsigned int input_frequency)
     else { return 44100; }
 }
 
+/* queries the spec of the default output device, SDL can only
+ * query the default device since 2.24, before that the first
+ * output device is used, which is the default one with most
+ * backends, returns false when no device can be queried */
+static bool query_output_device_spec(SDL_AudioSpec* device_spec)
+{
+#if SDL_VERSION_ATLEAST(2,24,0)
+    char* device_name = nullptr;
+
+    if (SDL_GetDefaultAudioInfo(&device_name, device_spec, 0) != 0)
+    {
+        DebugMessage(M64MSG_WARNING, "Couldn't query default audio device: %s", SDL_GetError());
+        return false;
+    }
+#elif SDL_VERSION_ATLEAST(2,0,16)
+    const char* device_name = SDL_GetAudioDeviceName(0, 0);
+
+    if (SDL_GetAudioDeviceSpec(0, 0, device_spec) != 0)
+    {
+        DebugMessage(M64MSG_WARNING, "Couldn't query audio device: %s", SDL_GetError());
+        return false;
+    }
+#else
+    return false;
+#endif
+
+#if SDL_VERSION_ATLEAST(2,0,16)
+    DebugMessage(M64MSG_VERBOSE, "Default audio device: %s (%iHz, " AFMT_FMTSPEC ").",
+        (device_name != nullptr) ? device_name : "unknown", device_spec->freq, AFMT_ARGS(device_spec->format));
+
+#if SDL_VERSION_ATLEAST(2,24,0)
+    SDL_free(device_name);
+#endif // SDL_VERSION_ATLEAST(2,24,0)
+
+    /* some backends don't know the frequency */
+    return device_spec->freq > 0;
+#endif // SDL_VERSION_ATLEAST(2,0,16)
+}
+
+static void select_native_output_spec(SDL_AudioSpec* spec)
+{
+    SDL_AudioSpec device_spec;
+
+    /* used when the device can't be queried, 48kHz is the
+     * mixing rate of most sound servers & devices, when the
+     * device uses another rate, SDL or the sound server converts
+     * it, and the obtained spec is what we resample to */
+    spec->freq = 48000;
+    spec->format = AUDIO_F32SYS;
+
+    if (!query_output_device_spec(&device_spec))
+    {
+        return;
+    }
+
+    spec->freq = device_spec.freq;
+    /* keep 16bit output when the device wants it,
+     * every other format is converted from float by SDL */
+    if (device_spec.format == AUDIO_S16SYS)
+    {
+        spec->format = AUDIO_S16SYS;
+    }
+}
+
 static void sdl_init_audio_device(struct sdl_backend* sdl_backend)
 {
     SDL_AudioSpec desired, obtained;
@@ -180,10 +365,18 @@ static void sdl_init_audio_device(struct sdl_backend* sdl_backend)
     DebugMessage(M64MSG_VERBOSE, "Primary buffer: %i output samples.", (uint32_t) sdl_backend->primary_buffer_size);
     DebugMessage(M64MSG_VERBOSE, "Primary target fullness: %i output samples.", (uint32_t) sdl_backend->target);
     DebugMessage(M64MSG_VERBOSE, "Secondary buffer: %i output samples.", (uint32_t) sdl_backend->secondary_buffer_size);
+    DebugMessage(M64MSG_VERBOSE, "Mixing kernel: %s.", mix_samples_kernel_name());
 
     memset(&desired, 0, sizeof(desired));
-    desired.freq = select_output_frequency(sdl_backend->input_frequency);
-    desired.format = AUDIO_S16SYS;
+    if (sdl_backend->native_output)
+    {
+        select_native_output_spec(&desired);
+    }
+    else
+    {
+        desired.freq = select_output_frequency(sdl_backend->input_frequency);
+        desired.format = AUDIO_S16SYS;
+    }
     desired.channels = 2;
     desired.samples = sdl_backend->secondary_buffer_size;
     desired.callback = my_audio_callback;
@@ -208,9 +401,19 @@ static void sdl_init_audio_device(struct sdl_backend* sdl_backend)
         DebugMessage(M64MSG_WARNING, "Obtained frequency (%i) differs from requested (%i).", obtained.freq, desired.freq);
     }
 
+    /* the capture can't change its frequency halfway through */
+    if (capture_is_running(sdl_backend->capture) &&
+        capture_frequency(sdl_backend->capture) != (unsigned int)obtained.freq)
+    {
+        DebugMessage(M64MSG_WARNING, "Stopping audio capture, output frequency changed to %i.", obtained.freq);
+        capture_stop(sdl_backend->capture);
+    }
+
     /* adjust some variables given the obtained audio spec */
     sdl_backend->output_frequency = obtained.freq;
     sdl_backend->secondary_buffer_size = obtained.samples;
+    sdl_backend->float_output = SDL_AUDIO_ISFLOAT(obtained.format) ? 1 : 0;
+    sdl_backend->output_sample_bytes = obtained.channels * SDL_AUDIO_BITSIZE(obtained.format) / 8;
 
     if (sdl_backend->target < sdl_backend->secondary_buffer_size)
         sdl_backend->target = sdl_backend->secondary_buffer_size;
@@ -224,6 +427,10 @@ static void sdl_init_audio_device(struct sdl_backend* sdl_backend)
     resize_primary_buffer(sdl_backend, new_primary_buffer_size(sdl_backend));
     sdl_backend->mix_buffer = (unsigned char*)realloc(sdl_backend->mix_buffer, sdl_backend->secondary_buffer_size * SDL_SAMPLE_BYTES);
 
+    /* the resampling ratio only changes here, in sdl_set_speed_factor
+     * and when sdl_apply_settings toggles the time stretcher */
+    configure_resampler(sdl_backend);
+
     /* preset the last callback time */
     if (sdl_backend->last_cb_time == 0) {
         sdl_backend->last_cb_time = SDL_GetTicks();
@@ -270,13 +477,37 @@ struct sdl_backend* init_sdl_backend(void)
         return nullptr;
     }
 
+    /* instanciate time stretcher */
+    struct time_stretch* time_stretch = init_time_stretch();
+    if (time_stretch == nullptr) {
+        iresampler->release(resampler);
+        free(sdl_backend);
+        return nullptr;
+    }
+
+    /* instanciate audio capture */
+    struct capture* capture = init_capture();
+    if (capture == nullptr) {
+        release_time_stretch(time_stretch);
+        iresampler->release(resampler);
+        free(sdl_backend);
+        return nullptr;
+    }
+
     sdl_backend->input_frequency = CoreSettingsGetIntValue(SettingsID::Audio_DefaultFrequency);
     sdl_backend->swap_channels = CoreSettingsGetBoolValue(SettingsID::Audio_SwapChannels);
     sdl_backend->audio_sync = CoreSettingsGetBoolValue(SettingsID::Audio_Synchronize);
+    sdl_backend->native_output = CoreSettingsGetBoolValue(SettingsID::Audio_NativeOutput);
     sdl_backend->paused_for_sync = 1;
     sdl_backend->speed_factor = 100;
     sdl_backend->resampler = resampler;
     sdl_backend->iresampler = iresampler;
+    sdl_backend->time_stretch_enabled = CoreSettingsGetBoolValue(SettingsID::Audio_TimeStretch);
+    sdl_backend->time_stretch = time_stretch;
+    sdl_backend->capture = capture;
+    sdl_backend->performance_frequency = SDL_GetPerformanceFrequency();
+
+    telemetry_reset();
 
     sdl_init_audio_device(sdl_backend);
 
@@ -288,9 +519,22 @@ void sdl_apply_settings(struct sdl_backend* sdl_backend)
     sdl_backend->input_frequency = CoreSettingsGetIntValue(SettingsID::Audio_DefaultFrequency);
     sdl_backend->swap_channels = CoreSettingsGetBoolValue(SettingsID::Audio_SwapChannels);
     sdl_backend->audio_sync = CoreSettingsGetBoolValue(SettingsID::Audio_Synchronize);
+    sdl_backend->native_output = CoreSettingsGetBoolValue(SettingsID::Audio_NativeOutput);
     sdl_backend->primary_buffer_size = CoreSettingsGetIntValue(SettingsID::Audio_PrimaryBufferSize);
     sdl_backend->target = CoreSettingsGetIntValue(SettingsID::Audio_PrimaryBufferTarget);
     sdl_backend->secondary_buffer_size = CoreSettingsGetIntValue(SettingsID::Audio_SecondaryBufferSize);
+
+    unsigned int time_stretch_enabled = CoreSettingsGetBoolValue(SettingsID::Audio_TimeStretch);
+    if (time_stretch_enabled == sdl_backend->time_stretch_enabled)
+        return;
+
+    /* toggling the time stretcher changes the resampling ratio,
+     * the audio callback mustn't see the flag and ratio disagree */
+    SDL_LockAudio();
+    sdl_backend->time_stretch_enabled = time_stretch_enabled;
+    if (sdl_backend->error == 0)
+        configure_resampler(sdl_backend);
+    SDL_UnlockAudio();
 }
 
 void release_sdl_backend(struct sdl_backend* sdl_backend)
@@ -312,6 +556,12 @@ void release_sdl_backend(struct sdl_backend* sdl_backend)
     /* release resampler */
     sdl_backend->iresampler->release(sdl_backend->resampler);
 
+    /* release time stretcher */
+    release_time_stretch(sdl_backend->time_stretch);
+
+    /* release audio capture, finishes the capture file */
+    release_capture(sdl_backend->capture);
+
     /* release sdl backend */
     free(sdl_backend);
 }
@@ -321,6 +571,22 @@ void sdl_set_frequency(struct sdl_backend* sdl_backend, unsigned int frequency)
     if (sdl_backend->error != 0)
         return;
 
+    /* Keep the device open and absorb the change in the resampler,
+     * reopening the device takes a while and results in an audible gap.
+     * The device is only reopened when it'd be opened at a higher frequency,
+     * to avoid degrading the quality for the rest of the session */
+    if (sdl_backend->native_output ||
+        select_output_frequency(frequency) <= sdl_backend->output_frequency)
+    {
+        SDL_LockAudio();
+        sdl_backend->input_frequency = frequency;
+        /* the primary buffer contents are kept */
+        resize_primary_buffer(sdl_backend, new_primary_buffer_size(sdl_backend));
+        configure_resampler(sdl_backend);
+        SDL_UnlockAudio();
+        return;
+    }
+
     sdl_backend->input_frequency = frequency;
     sdl_init_audio_device(sdl_backend);
 }
@@ -339,33 +605,20 @@ void sdl_push_samples(struct sdl_backend* sdl_backend, const void* src, size_t s
     }
     size = (size / 4) * 4;
 
+    /* the samples received from the core are the emulated time,
+     * the OSD compares it against the wall time to compute the speed */
+    uint64_t emulated_time = ((uint64_t)(size / N64_SAMPLE_BYTES) * 1000000) + sdl_backend->emulated_time_remainder;
+    CoreMetricsAdd(CoreMetric::EmulatedTime, emulated_time / sdl_backend->input_frequency);
+    sdl_backend->emulated_time_remainder = emulated_time % sdl_backend->input_frequency;
+
     /* We need to lock audio before accessing cbuff */
     SDL_LockAudio();
     unsigned char* dst = (unsigned char*)cbuff_head(&sdl_backend->primary_buffer, &available);
     if (size <= available)
     {
-        /* Confusing logic but, for LittleEndian host using memcpy will result in swapped channels,
-         * whereas the other branch will result in non-swapped channels.
-         * For BigEndian host this logic is inverted, memcpy will result in non swapped channels
-         * and the other branch will result in swapped channels.
-         *
-         * This is due to the fact that the core stores 32bit words in native order in RDRAM.
-         * For instance N64 bytes "Lh Ll Rh Rl" will be stored as "Rl Rh Ll Lh" on LittleEndian host
-         * and therefore should the non-memcpy path to get non swapped channels,
-         * whereas on BigEndian host the bytes will be stored as "Lh Ll Rh Rl" and therefore
-         * memcpy path results in the non-swapped channels outcome.
-         */
-        if (sdl_backend->swap_channels ^ (SDL_BYTEORDER == SDL_BIG_ENDIAN)) {
-            memcpy(dst, src, size);
-        }
-        else {
-            size_t i;
-            for (i = 0 ; i < size ; i += 4 )
-            {
-                memcpy(dst + i + 0, (const unsigned char*)src + i + 2, 2); /* Left */
-                memcpy(dst + i + 2, (const unsigned char*)src + i + 0, 2); /* Right */
-            }
-        }
+        /* the channel swap is deferred to mix_samples() in the audio callback,
+         * see output_swap_channels() */
+        memcpy(dst, src, size);
 
         produce_cbuff_data(&sdl_backend->primary_buffer, size);
     }
@@ -373,6 +626,7 @@ void sdl_push_samples(struct sdl_backend* sdl_backend, const void* src, size_t s
 
     if (size > available)
     {
+        telemetry_count(TELEMETRY_OVERRUNS, 1);
         DebugMessage(M64MSG_WARNING, "sdl_push_samples: pushing %zu bytes, but only %zu available !", size, available);
     }
 }
@@ -417,6 +671,9 @@ void sdl_synchronize_audio(struct sdl_backend* sdl_backend)
         if (sdl_backend->paused_for_sync) { SDL_PauseAudio(0); }
         sdl_backend->paused_for_sync = 0;
 
+        telemetry_record(TELEMETRY_SYNC_SLEEP_MS, wait_time);
+        telemetry_count(TELEMETRY_SYNC_SLEEP_TOTAL_MS, wait_time);
+
         SDL_Delay(wait_time);
     }
     else if (expected_level < sdl_backend->secondary_buffer_size)
@@ -442,6 +699,35 @@ void sdl_set_speed_factor(struct sdl_backend* sdl_backend, unsigned int speed_fa
 
     sdl_backend->speed_factor = speed_factor;
 
+    if (sdl_backend->error != 0)
+        return;
+
     /* we need a different size primary buffer to store the N64 samples when the speed changes */
     resize_primary_buffer(sdl_backend, new_primary_buffer_size(sdl_backend));
+
+    configure_resampler(sdl_backend);
+}
+
+int sdl_start_capture(struct sdl_backend* sdl_backend, const char* path)
+{
+    int ret;
+
+    if (sdl_backend->error != 0)
+        return -1;
+
+    std::string file = path;
+    file += capture_file_extension();
+
+    /* the audio callback mustn't push while the capture is (re)started */
+    SDL_LockAudio();
+    ret = capture_start(sdl_backend->capture, file.c_str(), sdl_backend->output_frequency);
+    SDL_UnlockAudio();
+
+    return ret;
+}
+
+void sdl_stop_capture(struct sdl_backend* sdl_backend)
+{
+    /* not locked, waiting for the writer thread would stall the audio callback */
+    capture_stop(sdl_backend->capture);
 }
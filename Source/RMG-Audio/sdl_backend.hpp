@@ -40,4 +40,10 @@ void sdl_synchronize_audio(struct sdl_backend* sdl_backend);
 
 void sdl_set_speed_factor(struct sdl_backend* sdl_backend, unsigned int speed_factor);
 
+/* starts recording the output to path with the capture file extension appended,
+ * returns 0 on success */
+int sdl_start_capture(struct sdl_backend* sdl_backend, const char* path);
+
+void sdl_stop_capture(struct sdl_backend* sdl_backend);
+
 #endif
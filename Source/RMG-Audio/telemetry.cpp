@@ -0,0 +1,127 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "telemetry.hpp"
+#include "main.hpp"
+
+#include <atomic>
+#include <string>
+
+//
+// Local Structures
+//
+
+struct telemetry_histogram_data
+{
+    const char* name;
+    const unsigned int bucket_width;
+    std::atomic<uint32_t> buckets[M64P_AUDIO_HISTOGRAM_BUCKETS];
+};
+
+//
+// Local Variables
+//
+
+static std::atomic<uint64_t> l_Counters[TELEMETRY_COUNTER_COUNT];
+
+static telemetry_histogram_data l_Histograms[TELEMETRY_HISTOGRAM_COUNT] =
+{
+    { "Primary buffer fill (ms)", 10, {} },
+    { "Resample time (us)", 50, {} },
+    { "Callback interval (ms)", 4, {} },
+    { "Sync sleep (ms)", 2, {} },
+};
+
+//
+// Local Functions
+//
+
+static void get_histogram(enum telemetry_histogram histogram, m64p_audio_histogram* dst)
+{
+    dst->bucket_width = l_Histograms[histogram].bucket_width;
+
+    for (int i = 0; i < M64P_AUDIO_HISTOGRAM_BUCKETS; i++)
+    {
+        dst->buckets[i] = l_Histograms[histogram].buckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+//
+// Exported Functions
+//
+
+void telemetry_reset(void)
+{
+    for (auto& counter : l_Counters)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+
+    for (auto& histogram : l_Histograms)
+    {
+        for (auto& bucket : histogram.buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void telemetry_count(enum telemetry_counter counter, uint64_t amount)
+{
+    l_Counters[counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void telemetry_record(enum telemetry_histogram histogram, uint32_t value)
+{
+    uint32_t bucket = value / l_Histograms[histogram].bucket_width;
+
+    if (bucket >= M64P_AUDIO_HISTOGRAM_BUCKETS)
+    {
+        bucket = M64P_AUDIO_HISTOGRAM_BUCKETS - 1;
+    }
+
+    l_Histograms[histogram].buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void telemetry_get(m64p_audio_statistics* statistics)
+{
+    statistics->callbacks           = l_Counters[TELEMETRY_CALLBACKS].load(std::memory_order_relaxed);
+    statistics->underruns           = l_Counters[TELEMETRY_UNDERRUNS].load(std::memory_order_relaxed);
+    statistics->overruns            = l_Counters[TELEMETRY_OVERRUNS].load(std::memory_order_relaxed);
+    statistics->sync_sleep_total_ms = l_Counters[TELEMETRY_SYNC_SLEEP_TOTAL_MS].load(std::memory_order_relaxed);
+    statistics->capture_dropped_frames = l_Counters[TELEMETRY_CAPTURE_DROPPED_FRAMES].load(std::memory_order_relaxed);
+
+    get_histogram(TELEMETRY_PRIMARY_BUFFER_FILL_MS, &statistics->primary_buffer_fill_ms);
+    get_histogram(TELEMETRY_RESAMPLE_TIME_US, &statistics->resample_time_us);
+    get_histogram(TELEMETRY_CALLBACK_INTERVAL_MS, &statistics->callback_interval_ms);
+    get_histogram(TELEMETRY_SYNC_SLEEP_MS, &statistics->sync_sleep_ms);
+}
+
+void telemetry_dump(void)
+{
+    DebugMessage(M64MSG_INFO, "Audio statistics: %llu callbacks, %llu underruns, %llu overruns, %llu ms sync sleep, %llu dropped capture frames",
+        (unsigned long long)l_Counters[TELEMETRY_CALLBACKS].load(std::memory_order_relaxed),
+        (unsigned long long)l_Counters[TELEMETRY_UNDERRUNS].load(std::memory_order_relaxed),
+        (unsigned long long)l_Counters[TELEMETRY_OVERRUNS].load(std::memory_order_relaxed),
+        (unsigned long long)l_Counters[TELEMETRY_SYNC_SLEEP_TOTAL_MS].load(std::memory_order_relaxed),
+        (unsigned long long)l_Counters[TELEMETRY_CAPTURE_DROPPED_FRAMES].load(std::memory_order_relaxed));
+
+    for (auto& histogram : l_Histograms)
+    {
+        std::string buckets;
+
+        for (auto& bucket : histogram.buckets)
+        {
+            buckets += " ";
+            buckets += std::to_string(bucket.load(std::memory_order_relaxed));
+        }
+
+        DebugMessage(M64MSG_INFO, "%s, %u wide buckets:%s", histogram.name, histogram.bucket_width, buckets.c_str());
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef M64P_TELEMETRY_H
+#define M64P_TELEMETRY_H
+
+#include <cstdint>
+
+#include <RMG-Core/m64p/api/m64p_custom.h>
+
+/* lock-free statistics of the audio pipeline,
+ * recorded from both the emulation and the SDL audio thread */
+
+enum telemetry_counter
+{
+    TELEMETRY_CALLBACKS,
+    TELEMETRY_UNDERRUNS,
+    TELEMETRY_OVERRUNS,
+    TELEMETRY_SYNC_SLEEP_TOTAL_MS,
+    TELEMETRY_CAPTURE_DROPPED_FRAMES,
+    TELEMETRY_COUNTER_COUNT
+};
+
+enum telemetry_histogram
+{
+    TELEMETRY_PRIMARY_BUFFER_FILL_MS,
+    TELEMETRY_RESAMPLE_TIME_US,
+    TELEMETRY_CALLBACK_INTERVAL_MS,
+    TELEMETRY_SYNC_SLEEP_MS,
+    TELEMETRY_HISTOGRAM_COUNT
+};
+
+void telemetry_reset(void);
+
+void telemetry_count(enum telemetry_counter counter, uint64_t amount);
+
+void telemetry_record(enum telemetry_histogram histogram, uint32_t value);
+
+void telemetry_get(m64p_audio_statistics* statistics);
+
+/* prints a summary using DebugMessage */
+void telemetry_dump(void);
+
+#endif // M64P_TELEMETRY_H
@@ -0,0 +1,302 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "time_stretch.hpp"
+#include "circular_buffer.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+//
+// Local Defines
+//
+
+/* assume 2x16bit interleaved channels */
+#define BYTES_PER_SAMPLE 4
+
+/* length of each copied sequence */
+#define SEQUENCE_MS 40
+/* range searched for the best matching sequence start */
+#define SEEK_WINDOW_MS 15
+/* length of the crossfade between sequences */
+#define OVERLAP_MS 8
+
+//
+// Local Structures
+//
+
+struct time_stretch
+{
+    unsigned int frequency;
+    unsigned int speed_factor;
+
+    /* lengths in samples */
+    size_t sequence_length;
+    size_t seek_length;
+    size_t overlap_length;
+
+    /* tail of the previous sequence, crossfaded with the next one */
+    int16_t* overlap_buffer;
+    bool has_overlap;
+
+    /* downmixed overlap buffer and seek window, used for the correlation */
+    float* overlap_mono;
+    float* seek_mono;
+
+    /* fractional part of the input position */
+    double input_position;
+
+    /* stretched output */
+    struct circular_buffer output;
+};
+
+//
+// Local Functions
+//
+
+static size_t ms_to_samples(unsigned int frequency, unsigned int ms)
+{
+    return ((size_t)frequency * ms) / 1000;
+}
+
+static void downmix(float* dst, const int16_t* src, size_t samples)
+{
+    for (size_t i = 0; i < samples; i++)
+    {
+        dst[i] = (float)src[i * 2] + (float)src[i * 2 + 1];
+    }
+}
+
+/* returns the offset in src (in samples) within the seek window which
+ * continues the previous sequence best, using normalized cross-correlation */
+static size_t find_best_offset(struct time_stretch* time_stretch, const int16_t* src)
+{
+    const size_t overlap_length = time_stretch->overlap_length;
+    const size_t seek_length = time_stretch->seek_length;
+    const float* ref = time_stretch->overlap_mono;
+    const float* window = time_stretch->seek_mono;
+
+    downmix(time_stretch->overlap_mono, time_stretch->overlap_buffer, overlap_length);
+    downmix(time_stretch->seek_mono, src, seek_length + overlap_length);
+
+    double norm = 0.0;
+    for (size_t i = 0; i < overlap_length; i++)
+    {
+        norm += (double)window[i] * window[i];
+    }
+
+    size_t best_offset = 0;
+    double best_correlation = -INFINITY;
+
+    for (size_t offset = 0; offset < seek_length; offset++)
+    {
+        float correlation = 0.0f;
+        for (size_t i = 0; i < overlap_length; i++)
+        {
+            correlation += ref[i] * window[offset + i];
+        }
+
+        double normalized = correlation / std::sqrt(norm + 1.0);
+        if (normalized > best_correlation)
+        {
+            best_correlation = normalized;
+            best_offset = offset;
+        }
+
+        /* slide the energy of the candidate window */
+        norm += (double)window[offset + overlap_length] * window[offset + overlap_length];
+        norm -= (double)window[offset] * window[offset];
+    }
+
+    return best_offset;
+}
+
+static int grow_output(struct time_stretch* time_stretch, size_t size)
+{
+    struct circular_buffer* output = &time_stretch->output;
+
+    if (output->head + size <= output->size)
+    {
+        return 0;
+    }
+
+    void* data = realloc(output->data, output->head + size);
+    if (data == nullptr)
+    {
+        return -1;
+    }
+
+    output->data = data;
+    output->size = output->head + size;
+    return 0;
+}
+
+//
+// Exported Functions
+//
+
+struct time_stretch* init_time_stretch(void)
+{
+    struct time_stretch* time_stretch = (struct time_stretch*)malloc(sizeof(*time_stretch));
+    if (time_stretch == nullptr)
+    {
+        return nullptr;
+    }
+
+    /* lazy-alloc of buffers */
+    memset(time_stretch, 0, sizeof(*time_stretch));
+    time_stretch->speed_factor = 100;
+
+    return time_stretch;
+}
+
+void release_time_stretch(struct time_stretch* time_stretch)
+{
+    if (time_stretch == nullptr)
+    {
+        return;
+    }
+
+    free(time_stretch->overlap_buffer);
+    free(time_stretch->overlap_mono);
+    free(time_stretch->seek_mono);
+    release_cbuff(&time_stretch->output);
+    free(time_stretch);
+}
+
+void time_stretch_configure(struct time_stretch* time_stretch, unsigned int frequency, unsigned int speed_factor)
+{
+    time_stretch->speed_factor = speed_factor;
+    time_stretch->input_position = 0.0;
+    time_stretch->has_overlap = false;
+    time_stretch->output.head = 0;
+
+    if (time_stretch->frequency == frequency)
+    {
+        return;
+    }
+
+    const size_t overlap_length = ms_to_samples(frequency, OVERLAP_MS);
+    const size_t seek_length = ms_to_samples(frequency, SEEK_WINDOW_MS);
+
+    /* the buffers only grow, so when an allocation fails the
+     * old buffers still fit the old frequency which is kept */
+    if (time_stretch->overlap_buffer == nullptr || time_stretch->overlap_mono == nullptr ||
+        overlap_length > time_stretch->overlap_length)
+    {
+        int16_t* overlap_buffer = (int16_t*)realloc(time_stretch->overlap_buffer, overlap_length * BYTES_PER_SAMPLE);
+        if (overlap_buffer == nullptr)
+        {
+            return;
+        }
+        time_stretch->overlap_buffer = overlap_buffer;
+
+        float* overlap_mono = (float*)realloc(time_stretch->overlap_mono, overlap_length * sizeof(float));
+        if (overlap_mono == nullptr)
+        {
+            return;
+        }
+        time_stretch->overlap_mono = overlap_mono;
+    }
+
+    if (time_stretch->seek_mono == nullptr ||
+        (seek_length + overlap_length) > (time_stretch->seek_length + time_stretch->overlap_length))
+    {
+        float* seek_mono = (float*)realloc(time_stretch->seek_mono, (seek_length + overlap_length) * sizeof(float));
+        if (seek_mono == nullptr)
+        {
+            return;
+        }
+        time_stretch->seek_mono = seek_mono;
+    }
+
+    time_stretch->frequency = frequency;
+    time_stretch->sequence_length = ms_to_samples(frequency, SEQUENCE_MS);
+    time_stretch->seek_length = seek_length;
+    time_stretch->overlap_length = overlap_length;
+}
+
+size_t time_stretch_process(struct time_stretch* time_stretch, const void* src, size_t src_size, size_t output_size)
+{
+    const size_t sequence_length = time_stretch->sequence_length;
+    const size_t overlap_length = time_stretch->overlap_length;
+    /* each sequence outputs sequence_length - overlap_length samples,
+     * the last overlap_length samples are crossfaded with the next sequence */
+    const size_t output_length = sequence_length - overlap_length;
+    const double tempo = time_stretch->speed_factor / 100.0;
+    const size_t src_length = src_size / BYTES_PER_SAMPLE;
+
+    size_t position = 0;
+
+    if (time_stretch->overlap_buffer == nullptr ||
+        time_stretch->overlap_mono == nullptr ||
+        time_stretch->seek_mono == nullptr)
+    {
+        return 0;
+    }
+
+    while (time_stretch->output.head < output_size)
+    {
+        const size_t skip = (size_t)(time_stretch->input_position + output_length * tempo);
+        size_t required = time_stretch->seek_length + sequence_length;
+        if (required < skip)
+        {
+            required = skip;
+        }
+
+        if (src_length - position < required ||
+            grow_output(time_stretch, output_length * BYTES_PER_SAMPLE) != 0)
+        {
+            break;
+        }
+
+        const int16_t* in = (const int16_t*)src + position * 2;
+        size_t available;
+        int16_t* out = (int16_t*)cbuff_head(&time_stretch->output, &available);
+
+        size_t i = 0;
+        if (time_stretch->has_overlap)
+        {
+            const int16_t* overlap = time_stretch->overlap_buffer;
+
+            in += find_best_offset(time_stretch, in) * 2;
+
+            /* linear crossfade from the previous sequence into this one */
+            for (; i < overlap_length * 2; i++)
+            {
+                const int32_t fade = (int32_t)(i / 2);
+                out[i] = (int16_t)((overlap[i] * ((int32_t)overlap_length - fade) + in[i] * fade) / (int32_t)overlap_length);
+            }
+        }
+
+        memcpy(out + i, in + i, (output_length * 2 - i) * sizeof(int16_t));
+        memcpy(time_stretch->overlap_buffer, in + output_length * 2, overlap_length * BYTES_PER_SAMPLE);
+        time_stretch->has_overlap = true;
+
+        produce_cbuff_data(&time_stretch->output, output_length * BYTES_PER_SAMPLE);
+
+        /* advance the input by the stretched amount, keeping the fractional part */
+        time_stretch->input_position += output_length * tempo;
+        time_stretch->input_position -= skip;
+        position += skip;
+    }
+
+    return position * BYTES_PER_SAMPLE;
+}
+
+const void* time_stretch_output(const struct time_stretch* time_stretch, size_t* available)
+{
+    return cbuff_tail(&time_stretch->output, available);
+}
+
+void time_stretch_consume(struct time_stretch* time_stretch, size_t amount)
+{
+    consume_cbuff_data(&time_stretch->output, amount);
+}
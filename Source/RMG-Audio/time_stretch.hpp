@@ -0,0 +1,35 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef M64P_TIME_STRETCH_H
+#define M64P_TIME_STRETCH_H
+
+#include <cstdlib>
+
+/* WSOLA based time stretcher for interleaved 16bit stereo samples,
+ * changes the tempo by speed_factor while keeping the pitch */
+struct time_stretch;
+
+struct time_stretch* init_time_stretch(void);
+
+void release_time_stretch(struct time_stretch* time_stretch);
+
+/* sets the sample frequency and speed factor (in percent), discards buffered output */
+void time_stretch_configure(struct time_stretch* time_stretch, unsigned int frequency, unsigned int speed_factor);
+
+/* stretches samples from src into the output buffer until it holds at least
+ * output_size bytes or src runs out, returns the number of consumed src bytes */
+size_t time_stretch_process(struct time_stretch* time_stretch, const void* src, size_t src_size, size_t output_size);
+
+/* returns the stretched output and the amount of available bytes */
+const void* time_stretch_output(const struct time_stretch* time_stretch, size_t* available);
+
+void time_stretch_consume(struct time_stretch* time_stretch, size_t amount);
+
+#endif // M64P_TIME_STRETCH_H
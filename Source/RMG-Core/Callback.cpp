@@ -60,6 +60,10 @@ void CoreDebugCallback(void* context, int level, const char* message)
 
 void CoreStateCallback(void* context, m64p_core_param param, int value)
 {
+    // input movies which start from a save state
+    // have to be started from the emulation thread
+    CoreInputMovieStateCallback((CoreStateCallbackType)param, value);
+
     if (!l_SetupCallbacks)
     {
         return;
@@ -17,6 +17,9 @@
 #include "RomSettings.hpp"
 #include "Directories.hpp"
 #include "MediaLoader.hpp"
+#include "InputLatency.hpp"
+#include "InputMovie.hpp"
+#include "Metrics.hpp"
 #include "Screenshot.hpp"
 #include "Emulation.hpp"
 #include "SaveState.hpp"
@@ -7,8 +7,12 @@
  *  You should have received a copy of the GNU General Public License
  *  along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
+#define CORE_INTERNAL
 #include "Settings/Settings.hpp"
 #include "MediaLoader.hpp"
+#include "InputLatency.hpp"
+#include "InputMovie.hpp"
+#include "Metrics.hpp"
 #include "RomSettings.hpp"
 #include "Emulation.hpp"
 #include "m64p/Api.hpp"
@@ -153,6 +157,15 @@ bool CoreStartEmulation(std::filesystem::path n64rom, std::filesystem::path n64d
     CoreDiscordRpcUpdate(true);
 #endif // DISCORD_RPC
 
+    // start power-on input movie
+    CoreInputMovieStartEmulation();
+
+    // start measuring input latency
+    CoreInputLatencyStartEmulation();
+
+    // reset the metrics and start counting VIs
+    CoreMetricsStartEmulation();
+
     ret = m64p::Core.DoCommand(M64CMD_EXECUTE, 0, nullptr);
     if (ret != M64ERR_SUCCESS)
     {
@@ -160,6 +173,12 @@ bool CoreStartEmulation(std::filesystem::path n64rom, std::filesystem::path n64d
         error += m64p::Core.ErrorMessage(ret);
     }
 
+    // stop counting VIs
+    CoreMetricsStopEmulation();
+
+    // stop measuring input latency
+    CoreInputLatencyStopEmulation();
+
     CoreClearCheats();
     CoreDetachPlugins();
     CoreCloseRom();
@@ -0,0 +1,315 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#define CORE_INTERNAL
+#include "InputLatency.hpp"
+#include "Metrics.hpp"
+#include "Directories.hpp"
+#include "Callback.hpp"
+#include "Error.hpp"
+#include "Settings/Settings.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+//
+// Local Defines
+//
+
+// maximum amount of measured inputs which are kept,
+// the oldest ones are overwritten when there are more
+#define INPUT_LATENCY_MAX_SAMPLES 65536
+
+//
+// Local Structures
+//
+
+struct InputLatencySample
+{
+    // steady clock times in nanoseconds
+    uint64_t EventTime = 0;
+    uint64_t PollTime  = 0;
+    uint64_t SwapTime  = 0;
+    // amount of frames rendered by
+    // the core when GetKeys was called
+    uint64_t Frame     = 0;
+};
+
+//
+// Local Variables
+//
+
+static std::atomic<bool> l_Measuring = false;
+
+// guards everything below, the samples are recorded
+// on the emulation thread and read by the frontend
+static std::mutex l_InputLatencyMutex;
+static std::vector<InputLatencySample> l_Samples;
+static size_t l_NextSample = 0;
+// input which is waiting for its buffer swap
+static InputLatencySample l_PendingSample;
+static bool l_HasPendingSample = false;
+static uint64_t l_LastEventTime = 0;
+
+//
+// Local Functions
+//
+
+static uint64_t get_time(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static CoreInputLatencyStage get_stage_statistics(std::vector<uint64_t>& latencies)
+{
+    CoreInputLatencyStage stage;
+
+    std::sort(latencies.begin(), latencies.end());
+
+    stage.Minimum = latencies.front() / 1000;
+    stage.Median  = latencies[latencies.size() / 2] / 1000;
+    stage.P95     = latencies[(latencies.size() * 95) / 100] / 1000;
+    stage.Maximum = latencies.back() / 1000;
+    return stage;
+}
+
+// returns the samples from oldest to newest,
+// expects l_InputLatencyMutex to be locked
+static std::vector<InputLatencySample> get_ordered_samples(void)
+{
+    std::vector<InputLatencySample> samples;
+
+    if (l_Samples.size() < INPUT_LATENCY_MAX_SAMPLES)
+    {
+        return l_Samples;
+    }
+
+    samples.reserve(l_Samples.size());
+    samples.insert(samples.end(), l_Samples.begin() + l_NextSample, l_Samples.end());
+    samples.insert(samples.end(), l_Samples.begin(), l_Samples.begin() + l_NextSample);
+    return samples;
+}
+
+//
+// Exported Functions
+//
+
+bool CoreIsInputLatencyMeasured(void)
+{
+    return l_Measuring.load(std::memory_order_relaxed);
+}
+
+void CoreInputLatencyRecordPoll(uint64_t eventTime)
+{
+    if (!l_Measuring.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const uint64_t time = get_time();
+
+    std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+
+    // every controller calls GetKeys, so make sure
+    // we only record an input event once
+    if (eventTime == 0 || eventTime <= l_LastEventTime)
+    {
+        return;
+    }
+    l_LastEventTime = eventTime;
+
+    // only measure a single input at a time,
+    // inputs during the measurement are skipped
+    if (l_HasPendingSample)
+    {
+        return;
+    }
+
+    l_PendingSample           = {};
+    l_PendingSample.EventTime = eventTime;
+    l_PendingSample.PollTime  = time;
+    l_PendingSample.Frame     = CoreMetricsGet(CoreMetric::RenderedFrames);
+    l_HasPendingSample        = true;
+}
+
+void CoreInputLatencyRecordSwap(void)
+{
+    if (!l_Measuring.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const uint64_t time = get_time();
+
+    std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+
+    // the input is presented by the
+    // first swap after GetKeys was called
+    if (!l_HasPendingSample)
+    {
+        return;
+    }
+
+    l_PendingSample.SwapTime = time;
+    l_HasPendingSample       = false;
+
+    if (l_Samples.size() < INPUT_LATENCY_MAX_SAMPLES)
+    {
+        l_Samples.push_back(l_PendingSample);
+    }
+    else
+    {
+        l_Samples[l_NextSample] = l_PendingSample;
+    }
+    l_NextSample = (l_NextSample + 1) % INPUT_LATENCY_MAX_SAMPLES;
+}
+
+bool CoreGetInputLatencyStatistics(CoreInputLatencyStatistics& statistics)
+{
+    std::vector<uint64_t> eventToPoll;
+    std::vector<uint64_t> pollToSwap;
+    std::vector<uint64_t> eventToSwap;
+
+    {
+        std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+
+        if (l_Samples.empty())
+        {
+            return false;
+        }
+
+        eventToPoll.reserve(l_Samples.size());
+        pollToSwap.reserve(l_Samples.size());
+        eventToSwap.reserve(l_Samples.size());
+
+        for (const InputLatencySample& sample : l_Samples)
+        {
+            eventToPoll.push_back(sample.PollTime - sample.EventTime);
+            pollToSwap.push_back(sample.SwapTime - sample.PollTime);
+            eventToSwap.push_back(sample.SwapTime - sample.EventTime);
+        }
+    }
+
+    statistics.Samples     = eventToPoll.size();
+    statistics.EventToPoll = get_stage_statistics(eventToPoll);
+    statistics.PollToSwap  = get_stage_statistics(pollToSwap);
+    statistics.EventToSwap = get_stage_statistics(eventToSwap);
+    return true;
+}
+
+bool CoreExportInputLatency(std::filesystem::path file)
+{
+    std::string error;
+    std::vector<InputLatencySample> samples;
+
+    {
+        std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+        samples = get_ordered_samples();
+    }
+
+    std::ofstream outputStream(file, std::ios::trunc);
+    if (!outputStream.is_open())
+    {
+        error = "CoreExportInputLatency Failed: ";
+        error += "failed to open file: ";
+        error += file.string();
+        CoreSetError(error);
+        return false;
+    }
+
+    outputStream << "frame,event_to_poll_us,poll_to_swap_us,total_us\n";
+
+    for (const InputLatencySample& sample : samples)
+    {
+        outputStream << sample.Frame << ','
+                     << (sample.PollTime - sample.EventTime) / 1000 << ','
+                     << (sample.SwapTime - sample.PollTime) / 1000 << ','
+                     << (sample.SwapTime - sample.EventTime) / 1000 << '\n';
+    }
+
+    outputStream.close();
+    if (outputStream.fail())
+    {
+        error = "CoreExportInputLatency Failed: ";
+        error += "failed to write file: ";
+        error += file.string();
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
+//
+// Internal Functions
+//
+
+void CoreInputLatencyStartEmulation(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+        l_Samples.clear();
+        l_NextSample       = 0;
+        l_HasPendingSample = false;
+        l_LastEventTime    = get_time();
+    }
+
+    l_Measuring = CoreSettingsGetBoolValue(SettingsID::Core_MeasureInputLatency);
+}
+
+void CoreInputLatencyStopEmulation(void)
+{
+    std::filesystem::path file;
+    std::string message;
+    char fileName[64];
+    bool hasSamples;
+
+    if (!l_Measuring)
+    {
+        return;
+    }
+
+    l_Measuring = false;
+
+    {
+        std::lock_guard<std::mutex> lock(l_InputLatencyMutex);
+        hasSamples = !l_Samples.empty();
+    }
+
+    if (!hasSamples)
+    {
+        return;
+    }
+
+    const std::time_t currentTime = std::time(nullptr);
+    std::strftime(fileName, sizeof(fileName), "InputLatency-%Y%m%d-%H%M%S.csv", std::localtime(&currentTime));
+
+    file = CoreGetUserDataDirectory();
+    file += "/InputLatency/";
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(file, errorCode);
+    file += fileName;
+
+    if (!CoreExportInputLatency(file))
+    {
+        CoreDebugCallback((void*)"[CORE]  ", (int)CoreDebugMessageType::Warning, CoreGetError().c_str());
+        return;
+    }
+
+    message = "exported input latency to ";
+    message += file.string();
+    CoreDebugCallback((void*)"[CORE]  ", (int)CoreDebugMessageType::Info, message.c_str());
+}
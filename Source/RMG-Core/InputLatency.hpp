@@ -0,0 +1,67 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_INPUTLATENCY_HPP
+#define CORE_INPUTLATENCY_HPP
+
+#include <filesystem>
+#include <cstdint>
+
+// latency distribution of a stage in microseconds
+struct CoreInputLatencyStage
+{
+    uint64_t Minimum = 0;
+    uint64_t Median  = 0;
+    uint64_t P95     = 0;
+    uint64_t Maximum = 0;
+};
+
+struct CoreInputLatencyStatistics
+{
+    // amount of measured inputs
+    uint64_t Samples = 0;
+    // input event to the GetKeys call which consumed it
+    CoreInputLatencyStage EventToPoll;
+    // GetKeys call to the first buffer swap after it,
+    // which is the first frame which can present the input
+    CoreInputLatencyStage PollToSwap;
+    // input event to the buffer swap which presented it
+    CoreInputLatencyStage EventToSwap;
+};
+
+// returns whether the input latency is being measured
+bool CoreIsInputLatencyMeasured(void);
+
+// records the GetKeys call of the input plugin, eventTime is
+// the steady clock time in nanoseconds of the newest input event
+// it has consumed, events which have already been recorded are ignored
+void CoreInputLatencyRecordPoll(uint64_t eventTime);
+
+// records a buffer swap of the frontend
+void CoreInputLatencyRecordSwap(void);
+
+// retrieves the statistics of the measured inputs,
+// returns false when there are none
+bool CoreGetInputLatencyStatistics(CoreInputLatencyStatistics& statistics);
+
+// writes the measured inputs as CSV to file
+bool CoreExportInputLatency(std::filesystem::path file);
+
+#ifdef CORE_INTERNAL
+// starts measuring the input latency when it's enabled,
+// should be called before emulation starts
+void CoreInputLatencyStartEmulation(void);
+
+// stops measuring the input latency and exports
+// the measured inputs, should be called after
+// emulation has stopped
+void CoreInputLatencyStopEmulation(void);
+#endif // CORE_INTERNAL
+
+#endif // CORE_INPUTLATENCY_HPP
@@ -0,0 +1,251 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#define CORE_INTERNAL
+#include "InputMovie.hpp"
+#include "Emulation.hpp"
+#include "SaveState.hpp"
+#include "Plugins.hpp"
+#include "Error.hpp"
+
+#include "m64p/Api.hpp"
+
+#include <mutex>
+
+//
+// Local Enums
+//
+
+enum class InputMovieAction
+{
+    None = 0,
+    Record,
+    Playback
+};
+
+//
+// Local Variables
+//
+
+// guards the pending movie, which is started
+// from the emulation thread
+static std::mutex l_InputMovieMutex;
+static InputMovieAction l_PendingAction = InputMovieAction::None;
+static CoreInputMovieStart l_PendingStart = CoreInputMovieStart::PowerOn;
+static std::filesystem::path l_PendingFile;
+// whether the save state has to be loaded
+// once emulation is running
+static bool l_PendingStateLoad = false;
+
+//
+// Local Functions
+//
+
+static void set_pending_movie(InputMovieAction action, std::filesystem::path file, CoreInputMovieStart start)
+{
+    std::lock_guard<std::mutex> lock(l_InputMovieMutex);
+    l_PendingAction    = action;
+    l_PendingFile      = file;
+    l_PendingStart     = start;
+    l_PendingStateLoad = false;
+}
+
+static void clear_pending_movie(void)
+{
+    set_pending_movie(InputMovieAction::None, {}, CoreInputMovieStart::PowerOn);
+}
+
+// expects l_InputMovieMutex to be locked
+static void start_pending_movie(void)
+{
+    bool fromSaveState = l_PendingStart == CoreInputMovieStart::SaveState;
+    bool ret = false;
+
+    switch (l_PendingAction)
+    {
+        default:
+        case InputMovieAction::None:
+            return;
+        case InputMovieAction::Record:
+            ret = CorePluginsStartInputMovieRecording(l_PendingFile, fromSaveState);
+            break;
+        case InputMovieAction::Playback:
+            ret = CorePluginsStartInputMoviePlayback(l_PendingFile, fromSaveState);
+            break;
+    }
+
+    if (!ret)
+    {
+        CoreDebugCallback((void*)"[CORE]  ", (int)CoreDebugMessageType::Error, CoreGetError().c_str());
+    }
+
+    l_PendingAction = InputMovieAction::None;
+}
+
+//
+// Exported Functions
+//
+
+bool CoreStartInputMovieRecording(std::filesystem::path file, CoreInputMovieStart start)
+{
+    std::string error;
+
+    if (start == CoreInputMovieStart::PowerOn)
+    {
+        if (CoreIsEmulationRunning() || CoreIsEmulationPaused())
+        {
+            error = "CoreStartInputMovieRecording Failed: ";
+            error += "cannot start power-on recording when emulation is running!";
+            CoreSetError(error);
+            return false;
+        }
+
+        set_pending_movie(InputMovieAction::Record, file, start);
+        return true;
+    }
+
+    set_pending_movie(InputMovieAction::Record, file, start);
+
+    // the recording starts when the
+    // save state has been saved
+    if (!CoreSaveState(CoreGetInputMovieSaveStatePath(file)))
+    {
+        clear_pending_movie();
+        return false;
+    }
+
+    return true;
+}
+
+bool CoreStartInputMoviePlayback(std::filesystem::path file)
+{
+    std::filesystem::path saveStatePath = CoreGetInputMovieSaveStatePath(file);
+    std::string error;
+    bool isRunning;
+
+    isRunning = CoreIsEmulationRunning() || CoreIsEmulationPaused();
+
+    if (!std::filesystem::exists(saveStatePath))
+    {
+        if (isRunning)
+        {
+            error = "CoreStartInputMoviePlayback Failed: ";
+            error += "cannot start power-on playback when emulation is running!";
+            CoreSetError(error);
+            return false;
+        }
+
+        set_pending_movie(InputMovieAction::Playback, file, CoreInputMovieStart::PowerOn);
+        return true;
+    }
+
+    set_pending_movie(InputMovieAction::Playback, file, CoreInputMovieStart::SaveState);
+
+    if (!isRunning)
+    { // load the save state once emulation is running
+        std::lock_guard<std::mutex> lock(l_InputMovieMutex);
+        l_PendingStateLoad = true;
+        return true;
+    }
+
+    // the playback starts when the
+    // save state has been loaded
+    if (!CoreLoadSaveState(saveStatePath))
+    {
+        clear_pending_movie();
+        return false;
+    }
+
+    return true;
+}
+
+bool CoreStopInputMovie(void)
+{
+    clear_pending_movie();
+
+    if (!CoreIsEmulationRunning() && !CoreIsEmulationPaused())
+    {
+        return true;
+    }
+
+    return CorePluginsStopInputMovie();
+}
+
+std::filesystem::path CoreGetInputMovieSaveStatePath(std::filesystem::path file)
+{
+    file += ".st";
+    return file;
+}
+
+//
+// Internal Functions
+//
+
+void CoreInputMovieStartEmulation(void)
+{
+    std::lock_guard<std::mutex> lock(l_InputMovieMutex);
+
+    if (l_PendingStart == CoreInputMovieStart::PowerOn)
+    {
+        start_pending_movie();
+    }
+}
+
+void CoreInputMovieStateCallback(CoreStateCallbackType type, int value)
+{
+    std::lock_guard<std::mutex> lock(l_InputMovieMutex);
+
+    if (l_PendingAction == InputMovieAction::None ||
+        l_PendingStart != CoreInputMovieStart::SaveState)
+    {
+        return;
+    }
+
+    switch (type)
+    {
+        default:
+            break;
+        case CoreStateCallbackType::EmulationState:
+        {
+            if (value == M64EMU_RUNNING && l_PendingStateLoad)
+            {
+                l_PendingStateLoad = false;
+                if (!CoreLoadSaveState(CoreGetInputMovieSaveStatePath(l_PendingFile)))
+                {
+                    CoreDebugCallback((void*)"[CORE]  ", (int)CoreDebugMessageType::Error, CoreGetError().c_str());
+                    l_PendingAction = InputMovieAction::None;
+                }
+            }
+        } break;
+        case CoreStateCallbackType::SaveStateSaved:
+        {
+            if (l_PendingAction == InputMovieAction::Record)
+            {
+                if (value == 0)
+                {
+                    l_PendingAction = InputMovieAction::None;
+                    return;
+                }
+                start_pending_movie();
+            }
+        } break;
+        case CoreStateCallbackType::SaveStateLoaded:
+        {
+            if (l_PendingAction == InputMovieAction::Playback && !l_PendingStateLoad)
+            {
+                if (value == 0)
+                {
+                    l_PendingAction = InputMovieAction::None;
+                    return;
+                }
+                start_pending_movie();
+            }
+        } break;
+    }
+}
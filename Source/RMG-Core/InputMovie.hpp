@@ -0,0 +1,53 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_INPUTMOVIE_HPP
+#define CORE_INPUTMOVIE_HPP
+
+#include <filesystem>
+
+#ifdef CORE_INTERNAL
+#include "Callback.hpp"
+#endif // CORE_INTERNAL
+
+enum class CoreInputMovieStart
+{
+    PowerOn = 0,
+    SaveState
+};
+
+// starts recording the input of the input plugin to file,
+// when start is PowerOn, the recording starts with the next
+// emulation, when start is SaveState, a save state is saved
+// next to the movie and the recording starts once it has been saved
+bool CoreStartInputMovieRecording(std::filesystem::path file, CoreInputMovieStart start);
+
+// starts playing back the input movie in file, when the movie
+// has a save state, it's loaded and the playback starts once
+// it has been loaded, otherwise the playback starts with
+// the next emulation
+bool CoreStartInputMoviePlayback(std::filesystem::path file);
+
+// stops recording or playing back the input movie
+bool CoreStopInputMovie(void);
+
+// returns the path of the save state of the input movie
+std::filesystem::path CoreGetInputMovieSaveStatePath(std::filesystem::path file);
+
+#ifdef CORE_INTERNAL
+// starts the pending power-on input movie,
+// should be called before emulation starts
+void CoreInputMovieStartEmulation(void);
+
+// starts the pending save state input movie
+// when its save state has been saved or loaded
+void CoreInputMovieStateCallback(CoreStateCallbackType type, int value);
+#endif // CORE_INTERNAL
+
+#endif // CORE_INPUTMOVIE_HPP
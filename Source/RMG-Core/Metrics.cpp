@@ -0,0 +1,188 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#define CORE_INTERNAL
+#include "RomHeader.hpp"
+#include "Metrics.hpp"
+
+#include "m64p/Api.hpp"
+
+#include <atomic>
+#include <chrono>
+
+//
+// Local Variables
+//
+
+// the metrics are published from the emulation,
+// audio & render threads, so everything is atomic
+static std::atomic<uint64_t> l_Metrics[(int)CoreMetric::Count];
+static std::atomic<uint32_t> l_PublishedMetrics = 0;
+
+// ring of frame times in microseconds,
+// l_FrameTimeCount is the total amount of
+// recorded frame times
+static std::atomic<uint32_t> l_FrameTimes[CORE_METRICS_MAX_FRAME_TIMES];
+static std::atomic<uint64_t> l_FrameTimeCount = 0;
+// only used by the thread which swaps the buffers
+static std::chrono::time_point<std::chrono::steady_clock> l_LastFrameTime;
+static bool l_HasLastFrameTime = false;
+
+static std::atomic<int> l_VIRate = 60;
+
+//
+// Local Functions
+//
+
+static void set_published(CoreMetric metric)
+{
+    const uint32_t bit = 1 << (int)metric;
+
+    // avoid the read-modify-write
+    // once the metric has been published
+    if ((l_PublishedMetrics.load(std::memory_order_relaxed) & bit) == 0)
+    {
+        l_PublishedMetrics.fetch_or(bit, std::memory_order_relaxed);
+    }
+}
+
+static int get_vi_rate(uint32_t countryCode)
+{
+    switch (countryCode & 0xFF)
+    {
+    // PAL
+    case 0x44: // Germany
+    case 0x46: // France
+    case 0x49: // Italy
+    case 0x50: // Europe
+    case 0x53: // Spain
+    case 0x55: // Australia
+    case 0x58:
+    case 0x59:
+        return 50;
+    // NTSC & MPAL
+    default:
+        return 60;
+    }
+}
+
+static void frame_callback(unsigned int frameIndex)
+{
+    CoreMetricsAdd(CoreMetric::RenderedFrames, 1);
+}
+
+//
+// Exported Functions
+//
+
+void CoreMetricsAdd(CoreMetric metric, uint64_t amount)
+{
+    l_Metrics[(int)metric].fetch_add(amount, std::memory_order_relaxed);
+    set_published(metric);
+}
+
+void CoreMetricsSet(CoreMetric metric, uint64_t value)
+{
+    l_Metrics[(int)metric].store(value, std::memory_order_relaxed);
+    set_published(metric);
+}
+
+uint64_t CoreMetricsGet(CoreMetric metric)
+{
+    return l_Metrics[(int)metric].load(std::memory_order_relaxed);
+}
+
+bool CoreMetricsIsPublished(CoreMetric metric)
+{
+    return (l_PublishedMetrics.load(std::memory_order_relaxed) & (1 << (int)metric)) != 0;
+}
+
+void CoreMetricsRecordFrame(void)
+{
+    const auto currentTime = std::chrono::steady_clock::now();
+
+    CoreMetricsAdd(CoreMetric::Frames, 1);
+
+    if (l_HasLastFrameTime)
+    {
+        const uint64_t count = l_FrameTimeCount.load(std::memory_order_relaxed);
+        const uint32_t frameTime = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(currentTime - l_LastFrameTime).count();
+
+        l_FrameTimes[count % CORE_METRICS_MAX_FRAME_TIMES].store(frameTime, std::memory_order_relaxed);
+        l_FrameTimeCount.store(count + 1, std::memory_order_release);
+    }
+
+    l_LastFrameTime    = currentTime;
+    l_HasLastFrameTime = true;
+}
+
+int CoreMetricsGetFrameTimes(uint32_t* frameTimes, int count)
+{
+    const uint64_t frameTimeCount = l_FrameTimeCount.load(std::memory_order_acquire);
+    uint64_t available = frameTimeCount;
+
+    if (available > CORE_METRICS_MAX_FRAME_TIMES)
+    {
+        available = CORE_METRICS_MAX_FRAME_TIMES;
+    }
+
+    if ((uint64_t)count > available)
+    {
+        count = (int)available;
+    }
+
+    // a frame time might be overwritten while we're
+    // copying it, which is fine for displaying them
+    for (int i = 0; i < count; i++)
+    {
+        const uint64_t index = frameTimeCount - count + i;
+        frameTimes[i] = l_FrameTimes[index % CORE_METRICS_MAX_FRAME_TIMES].load(std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+int CoreMetricsGetVIRate(void)
+{
+    return l_VIRate.load(std::memory_order_relaxed);
+}
+
+//
+// Internal Functions
+//
+
+void CoreMetricsStartEmulation(void)
+{
+    CoreRomHeader romHeader;
+
+    for (std::atomic<uint64_t>& metric : l_Metrics)
+    {
+        metric.store(0, std::memory_order_relaxed);
+    }
+    l_PublishedMetrics = 0;
+
+    l_FrameTimeCount   = 0;
+    l_HasLastFrameTime = false;
+
+    if (CoreGetCurrentRomHeader(romHeader))
+    {
+        l_VIRate = get_vi_rate(romHeader.CountryCode);
+    }
+    else
+    {
+        l_VIRate = 60;
+    }
+
+    m64p::Core.DoCommand(M64CMD_SET_FRAME_CALLBACK, 0, (void*)&frame_callback);
+}
+
+void CoreMetricsStopEmulation(void)
+{
+    m64p::Core.DoCommand(M64CMD_SET_FRAME_CALLBACK, 0, nullptr);
+}
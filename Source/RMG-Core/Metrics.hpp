@@ -0,0 +1,80 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_METRICS_HPP
+#define CORE_METRICS_HPP
+
+#include <cstdint>
+
+// maximum amount of frame times which are kept
+#define CORE_METRICS_MAX_FRAME_TIMES 256
+
+enum class CoreMetric
+{
+    // amount of frames rendered by the core, counted
+    // by the frame callback of the core, the core doesn't
+    // notify about VIs so they aren't counted
+    RenderedFrames = 0,
+    // amount of presented frames, published by the frontend
+    Frames,
+    // fill of the audio buffer in milliseconds,
+    // published by the audio plugin
+    AudioBufferFill,
+    // amount of audio underruns, published by the audio plugin
+    AudioUnderruns,
+    // time between the newest input event and the GetKeys
+    // call which consumed it in microseconds,
+    // published by the input plugin
+    InputPollLatency,
+    // emulated time in microseconds, derived from the
+    // audio samples received from the core,
+    // published by the audio plugin
+    EmulatedTime,
+    Count
+};
+
+// adds amount to the counter metric,
+// doesn't lock so it can be called from any thread
+void CoreMetricsAdd(CoreMetric metric, uint64_t amount);
+
+// sets the value of the gauge metric,
+// doesn't lock so it can be called from any thread
+void CoreMetricsSet(CoreMetric metric, uint64_t value);
+
+// returns the current value of the metric
+uint64_t CoreMetricsGet(CoreMetric metric);
+
+// returns whether the metric has been
+// published since emulation has started
+bool CoreMetricsIsPublished(CoreMetric metric);
+
+// records a presented frame and its frame time,
+// should only be called by the thread which
+// swaps the buffers
+void CoreMetricsRecordFrame(void);
+
+// copies up to count of the newest frame times in
+// microseconds, from oldest to newest, into frameTimes,
+// returns the amount of frame times copied
+int CoreMetricsGetFrameTimes(uint32_t* frameTimes, int count);
+
+// returns the VI rate of the running ROM
+int CoreMetricsGetVIRate(void);
+
+#ifdef CORE_INTERNAL
+// resets the metrics and starts counting rendered frames,
+// should be called before emulation starts
+void CoreMetricsStartEmulation(void);
+
+// stops counting rendered frames, should be
+// called after emulation has stopped
+void CoreMetricsStopEmulation(void);
+#endif // CORE_INTERNAL
+
+#endif // CORE_METRICS_HPP
@@ -484,6 +484,195 @@ bool CorePluginsOpenROMConfig(CorePluginType type)
     return open_plugin_config(type, true);
 }
 
+bool CorePluginsGetAudioStatistics(CoreAudioStatistics& statistics)
+{
+    m64p::PluginApi* plugin;
+    m64p_audio_statistics audioStatistics;
+
+    plugin = get_plugin(CorePluginType::Audio);
+
+    if (!plugin->IsHooked() ||
+        plugin->GetAudioStatistics == nullptr ||
+        plugin->GetAudioStatistics(&audioStatistics) != M64ERR_SUCCESS)
+    {
+        return false;
+    }
+
+    auto convertHistogram = [](const m64p_audio_histogram& histogram)
+    {
+        CoreAudioHistogram coreHistogram;
+        coreHistogram.BucketWidth = histogram.bucket_width;
+        for (int i = 0; i < M64P_AUDIO_HISTOGRAM_BUCKETS; i++)
+        {
+            coreHistogram.Buckets[i] = histogram.buckets[i];
+        }
+        return coreHistogram;
+    };
+
+    statistics.Callbacks           = audioStatistics.callbacks;
+    statistics.Underruns           = audioStatistics.underruns;
+    statistics.Overruns            = audioStatistics.overruns;
+    statistics.SyncSleepTotalMs    = audioStatistics.sync_sleep_total_ms;
+    statistics.CaptureDroppedFrames = audioStatistics.capture_dropped_frames;
+    statistics.PrimaryBufferFillMs = convertHistogram(audioStatistics.primary_buffer_fill_ms);
+    statistics.ResampleTimeUs      = convertHistogram(audioStatistics.resample_time_us);
+    statistics.CallbackIntervalMs  = convertHistogram(audioStatistics.callback_interval_ms);
+    statistics.SyncSleepMs         = convertHistogram(audioStatistics.sync_sleep_ms);
+    return true;
+}
+
+bool CorePluginsStartAudioCapture(std::filesystem::path path)
+{
+    std::string error;
+    m64p::PluginApi* plugin;
+    m64p_error ret;
+
+    plugin = get_plugin(CorePluginType::Audio);
+
+    if (!plugin->IsHooked() || plugin->StartAudioCapture == nullptr)
+    {
+        error = "CorePluginsStartAudioCapture Failed: ";
+        error += "audio plugin doesn't support audio capture!";
+        CoreSetError(error);
+        return false;
+    }
+
+    ret = plugin->StartAudioCapture(path.string().c_str());
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CorePluginsStartAudioCapture (";
+        error += get_plugin_type_name(CorePluginType::Audio);
+        error += ")->StartAudioCapture() Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
+bool CorePluginsStopAudioCapture(void)
+{
+    std::string error;
+    m64p::PluginApi* plugin;
+    m64p_error ret;
+
+    plugin = get_plugin(CorePluginType::Audio);
+
+    if (!plugin->IsHooked() || plugin->StopAudioCapture == nullptr)
+    {
+        error = "CorePluginsStopAudioCapture Failed: ";
+        error += "audio plugin doesn't support audio capture!";
+        CoreSetError(error);
+        return false;
+    }
+
+    ret = plugin->StopAudioCapture();
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CorePluginsStopAudioCapture (";
+        error += get_plugin_type_name(CorePluginType::Audio);
+        error += ")->StopAudioCapture() Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
+bool CorePluginsStartInputMovieRecording(std::filesystem::path path, bool fromSaveState)
+{
+    std::string error;
+    m64p::PluginApi* plugin;
+    m64p_error ret;
+
+    plugin = get_plugin(CorePluginType::Input);
+
+    if (!plugin->IsHooked() || plugin->StartInputMovieRecording == nullptr)
+    {
+        error = "CorePluginsStartInputMovieRecording Failed: ";
+        error += "input plugin doesn't support input movies!";
+        CoreSetError(error);
+        return false;
+    }
+
+    ret = plugin->StartInputMovieRecording(path.string().c_str(),
+        fromSaveState ? M64P_INPUT_MOVIE_SAVE_STATE : M64P_INPUT_MOVIE_POWER_ON);
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CorePluginsStartInputMovieRecording (";
+        error += get_plugin_type_name(CorePluginType::Input);
+        error += ")->StartInputMovieRecording() Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
+bool CorePluginsStartInputMoviePlayback(std::filesystem::path path, bool fromSaveState)
+{
+    std::string error;
+    m64p::PluginApi* plugin;
+    m64p_error ret;
+
+    plugin = get_plugin(CorePluginType::Input);
+
+    if (!plugin->IsHooked() || plugin->StartInputMoviePlayback == nullptr)
+    {
+        error = "CorePluginsStartInputMoviePlayback Failed: ";
+        error += "input plugin doesn't support input movies!";
+        CoreSetError(error);
+        return false;
+    }
+
+    ret = plugin->StartInputMoviePlayback(path.string().c_str(),
+        fromSaveState ? M64P_INPUT_MOVIE_SAVE_STATE : M64P_INPUT_MOVIE_POWER_ON);
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CorePluginsStartInputMoviePlayback (";
+        error += get_plugin_type_name(CorePluginType::Input);
+        error += ")->StartInputMoviePlayback() Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
+bool CorePluginsStopInputMovie(void)
+{
+    std::string error;
+    m64p::PluginApi* plugin;
+    m64p_error ret;
+
+    plugin = get_plugin(CorePluginType::Input);
+
+    if (!plugin->IsHooked() || plugin->StopInputMovie == nullptr)
+    {
+        error = "CorePluginsStopInputMovie Failed: ";
+        error += "input plugin doesn't support input movies!";
+        CoreSetError(error);
+        return false;
+    }
+
+    ret = plugin->StopInputMovie();
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CorePluginsStopInputMovie (";
+        error += get_plugin_type_name(CorePluginType::Input);
+        error += ")->StopInputMovie() Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    return true;
+}
+
 bool CoreAttachPlugins(void)
 {
     std::string error;
@@ -10,8 +10,13 @@
 #ifndef CORE_PLUGINS_HPP
 #define CORE_PLUGINS_HPP
 
+#include "m64p/api/m64p_custom.h"
+
+#include <filesystem>
 #include <string>
 #include <vector>
+#include <array>
+#include <cstdint>
 
 enum class CorePluginType
 {
@@ -29,6 +34,28 @@ struct CorePlugin
     CorePluginType Type;
 };
 
+struct CoreAudioHistogram
+{
+    // width of each bucket, the last bucket
+    // also contains every value above it
+    uint32_t BucketWidth = 0;
+    std::array<uint32_t, M64P_AUDIO_HISTOGRAM_BUCKETS> Buckets = {};
+};
+
+struct CoreAudioStatistics
+{
+    uint64_t Callbacks         = 0;
+    uint64_t Underruns         = 0;
+    uint64_t Overruns          = 0;
+    uint64_t SyncSleepTotalMs  = 0;
+    uint64_t CaptureDroppedFrames = 0;
+
+    CoreAudioHistogram PrimaryBufferFillMs;
+    CoreAudioHistogram ResampleTimeUs;
+    CoreAudioHistogram CallbackIntervalMs;
+    CoreAudioHistogram SyncSleepMs;
+};
+
 // retrieves all available plugins
 std::vector<CorePlugin> CoreGetAllPlugins(void);
 
@@ -60,6 +87,32 @@ bool CorePluginsHasROMConfig(CorePluginType type);
 // used plugin of given type
 bool CorePluginsOpenROMConfig(CorePluginType type);
 
+// retrieves the statistics of the currently used
+// audio plugin, returns false when unsupported
+bool CorePluginsGetAudioStatistics(CoreAudioStatistics& statistics);
+
+// starts recording the output of the currently used audio
+// plugin to path, the plugin appends the file extension
+bool CorePluginsStartAudioCapture(std::filesystem::path path);
+
+// stops recording the output of the
+// currently used audio plugin
+bool CorePluginsStopAudioCapture(void);
+
+#ifdef CORE_INTERNAL
+// starts recording the keys of the currently
+// used input plugin to path
+bool CorePluginsStartInputMovieRecording(std::filesystem::path path, bool fromSaveState);
+
+// starts playing back the input movie in path
+// with the currently used input plugin
+bool CorePluginsStartInputMoviePlayback(std::filesystem::path path, bool fromSaveState);
+
+// stops recording or playing back the input
+// movie of the currently used input plugin
+bool CorePluginsStopInputMovie(void);
+#endif // CORE_INTERNAL
+
 // attaches all used plugins
 bool CoreAttachPlugins(void);
 
@@ -182,6 +182,9 @@ static l_Setting get_setting(SettingsID settingId)
     case SettingsID::GUI_OnScreenDisplayDuration:
         setting = {SETTING_SECTION_GUI, "OnScreenDisplayDuration", 3};
         break;
+    case SettingsID::GUI_OnScreenDisplayPerformance:
+        setting = {SETTING_SECTION_GUI, "OnScreenDisplayPerformance", false};
+        break;
     case SettingsID::GUI_Toolbar:
         setting = {SETTING_SECTION_GUI, "Toolbar", true};
         break;
@@ -257,6 +260,10 @@ static l_Setting get_setting(SettingsID settingId)
         setting = {SETTING_SECTION_CORE, "UserCacheDirectory", CoreGetDefaultUserCacheDirectory()};
         break;
 
+    case SettingsID::Core_MeasureInputLatency:
+        setting = {SETTING_SECTION_CORE, "MeasureInputLatency", false};
+        break;
+
     case SettingsID::Core_OverrideGameSpecificSettings:
         setting = {SETTING_SECTION_CORE, "OverrideGameSpecificSettings", false};
         break;
@@ -431,6 +438,9 @@ static l_Setting get_setting(SettingsID settingId)
     case SettingsID::KeyBinding_Screenshot:
         setting = {SETTING_SECTION_KEYBIND, "Screenshot", "F3"};
         break;
+    case SettingsID::KeyBinding_AudioCapture:
+        setting = {SETTING_SECTION_KEYBIND, "AudioCapture", "Shift+F3"};
+        break;
     case SettingsID::KeyBinding_LimitFPS:
         setting = {SETTING_SECTION_KEYBIND, "LimitFPS", "F4"};
         break;
@@ -524,6 +534,9 @@ static l_Setting get_setting(SettingsID settingId)
     case SettingsID::Keybinding_ViewLog:
         setting = {SETTING_SECTION_KEYBIND, "ViewLog", "Ctrl+L"};
         break;
+    case SettingsID::KeyBinding_PerformanceOverlay:
+        setting = {SETTING_SECTION_KEYBIND, "PerformanceOverlay", "Ctrl+P"};
+        break;
     case SettingsID::KeyBinding_GraphicsSettings:
         setting = {SETTING_SECTION_KEYBIND, "GraphicsSettings", "Ctrl+G"};
         break;
@@ -617,6 +630,12 @@ static l_Setting get_setting(SettingsID settingId)
     case SettingsID::Audio_Synchronize:
         setting = {SETTING_SECTION_AUDIO, "Synchronize", false};
         break;
+    case SettingsID::Audio_NativeOutput:
+        setting = {SETTING_SECTION_AUDIO, "NativeOutput", false};
+        break;
+    case SettingsID::Audio_TimeStretch:
+        setting = {SETTING_SECTION_AUDIO, "TimeStretch", false};
+        break;
 
     case SettingsID::RSP_Fallback:
         setting = {SETTING_SECTION_RSP, "RspFallback", CoreGetPluginDirectory().string() +
@@ -666,6 +685,15 @@ static l_Setting get_setting(SettingsID settingId)
     case SettingsID::Input_GameboySave:
         setting = {"", "GameboySave"};
         break;
+    case SettingsID::Input_UseRawHid:
+        setting = {"", "UseRawHid", false};
+        break;
+    case SettingsID::Input_MeasureHidLatency:
+        setting = {"", "MeasureHidLatency", false};
+        break;
+    case SettingsID::Input_ProfileHash:
+        setting = {"", "ProfileHash"};
+        break;
     case SettingsID::Input_RemoveDuplicateMappings:
         setting = {"", "RemoveDuplicateMappings"};
         break;
@@ -1773,6 +1801,39 @@ bool CoreSettingsKeyExists(std::string section, std::string key)
     return config_key_exists(section, key);
 }
 
+bool CoreSettingsGetSectionValues(std::string section, std::vector<std::pair<std::string, std::string>>& values)
+{
+    std::string error;
+    m64p_error ret;
+    const char* value;
+
+    values.clear();
+
+    if (!config_section_open(section))
+    {
+        return false;
+    }
+
+    l_keyList.clear();
+
+    ret = m64p::Config.ListParameters(l_sectionHandle, nullptr, &config_listkeys_callback);
+    if (ret != M64ERR_SUCCESS)
+    {
+        error = "CoreSettingsGetSectionValues m64p::Config.ListParameters Failed: ";
+        error += m64p::Core.ErrorMessage(ret);
+        CoreSetError(error);
+        return false;
+    }
+
+    for (const std::string& key : l_keyList)
+    {
+        value = m64p::Config.GetParamString(l_sectionHandle, key.c_str());
+        values.emplace_back(key, value != nullptr ? value : "");
+    }
+
+    return true;
+}
+
 bool CoreSettingsSetValue(SettingsID settingId, int value)
 {
     l_Setting setting = get_setting(settingId);
@@ -13,6 +13,7 @@
 #include "SettingsID.hpp"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 // saves settings to file
@@ -36,6 +37,10 @@ bool CoreSettingsDeleteSection(std::string section);
 // returns whether a key in the given section exists
 bool CoreSettingsKeyExists(std::string section, std::string key);
 
+// retrieves the keys and values of the given section,
+// the values are converted to strings
+bool CoreSettingsGetSectionValues(std::string section, std::vector<std::pair<std::string, std::string>>& values);
+
 // sets setting as int value
 bool CoreSettingsSetValue(SettingsID settingId, int value);
 // sets setting as bool value
@@ -19,6 +19,7 @@ enum class SettingsID
     GUI_OnScreenDisplayPaddingY,
     GUI_OnScreenDisplayOpacity,
     GUI_OnScreenDisplayDuration,
+    GUI_OnScreenDisplayPerformance,
     GUI_Toolbar,
     GUI_ToolbarArea,
     GUI_StatusBar,
@@ -40,6 +41,9 @@ enum class SettingsID
     Core_UserDataDirOverride,
     Core_UserCacheDirOverride,
 
+    // Core Measurement Settings
+    Core_MeasureInputLatency,
+
     // Core 64DD ROM Settings
     Core_64DD_JapaneseIPL,
     Core_64DD_AmericanIPL,
@@ -112,6 +116,7 @@ enum class SettingsID
     KeyBinding_HardReset,
     KeyBinding_Resume,
     KeyBinding_Screenshot,
+    KeyBinding_AudioCapture,
     KeyBinding_LimitFPS,
     KeyBinding_SpeedFactor25,
     KeyBinding_SpeedFactor50,
@@ -143,6 +148,7 @@ enum class SettingsID
     KeyBinding_SaveStateSlot9,
     KeyBinding_Fullscreen,
     Keybinding_ViewLog,
+    KeyBinding_PerformanceOverlay,
     KeyBinding_GraphicsSettings,
     KeyBinding_AudioSettings,
     KeyBinding_RspSettings,
@@ -179,6 +185,8 @@ enum class SettingsID
     Audio_Volume,
     Audio_Muted,
     Audio_Synchronize,
+    Audio_NativeOutput,
+    Audio_TimeStretch,
 
     // HLE RSP Plugin Settings
     RSP_Fallback,
@@ -196,6 +204,9 @@ enum class SettingsID
     Input_Pak,
     Input_GameboyRom,
     Input_GameboySave,
+    Input_UseRawHid,
+    Input_MeasureHidLatency,
+    Input_ProfileHash,
     Input_RemoveDuplicateMappings,
     Input_FilterEventsForButtons,
     Input_FilterEventsForAxis,
@@ -9,69 +9,245 @@
  */
 #include "Unzip.hpp"
 #include "Error.hpp"
+#include "osal/osal_files.hpp"
 
-#include <exception>
+#include <condition_variable>
 #include <filesystem>
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <set>
 #include <unzip.h>
 
 //
 // Local Defines
 //
 
-#define UNZIP_READ_SIZE 67108860 /* 64 MiB */
+#define UNZIP_READ_SIZE   262144 /* 256 KiB */
+#define UNZIP_MAX_THREADS 8
+
+// interval at which progressCallback is called
+#define UNZIP_PROGRESS_INTERVAL std::chrono::milliseconds(100)
 
 //
-// Exported Functions
+// Local Structures
 //
 
-bool CoreUnzip(std::filesystem::path file, std::filesystem::path path)
+struct UnzipEntry
 {
-    std::string error;
+    std::filesystem::path TargetPath;
+    unz64_file_pos        Position;
+    uint64_t              Size;
+};
+
+// state shared between the extraction threads
+struct UnzipState
+{
+    std::filesystem::path File;
+    std::vector<UnzipEntry> Entries;
+
+    std::atomic<size_t>   NextEntry = 0;
+    std::atomic<uint64_t> ExtractedBytes = 0;
+    std::atomic<bool>     Failed = false;
+
+    std::mutex              Mutex;
+    std::condition_variable Condition;
+    std::string             Error;
+    int                     FinishedThreads = 0;
+};
+
+//
+// Local Functions
+//
 
-    unzFile         zipFile;
-    unz_global_info zipInfo;
-    std::ofstream   outputStream;
-    char* read_buffer = (char*)malloc(UNZIP_READ_SIZE);
-    size_t bytes_read = 0;
+static void unzip_set_error(UnzipState& state, std::string error)
+{
+    std::lock_guard<std::mutex> lock(state.Mutex);
 
-    if (read_buffer == nullptr)
+    // only keep the first error
+    if (!state.Failed)
     {
-        error = "CoreUnzip: malloc Failed!";
-        CoreSetError(error);
+        state.Error  = error;
+        state.Failed = true;
+    }
+}
+
+static bool unzip_extract_entry(UnzipState& state, unzFile zipFile, char* readBuffer, const UnzipEntry& entry)
+{
+    std::string   error;
+    std::ofstream outputStream;
+    int           bytesRead;
+    uint64_t      bytesWritten = 0;
+
+    if (unzGoToFilePos64(zipFile, &entry.Position) != UNZ_OK)
+    {
+        unzip_set_error(state, "CoreUnzip: unzGoToFilePos64 Failed!");
+        return false;
+    }
+
+    if (unzOpenCurrentFile(zipFile) != UNZ_OK)
+    {
+        unzip_set_error(state, "CoreUnzip: unzOpenCurrentFile Failed!");
+        return false;
+    }
+
+    // reserve the space up front so the
+    // file doesn't get fragmented by the
+    // other threads writing their files
+    if (!osal_files_preallocate_file(entry.TargetPath, entry.Size))
+    {
+        unzCloseCurrentFile(zipFile);
+        error = "CoreUnzip: osal_files_preallocate_file(";
+        error += entry.TargetPath.string();
+        error += ") Failed!";
+        unzip_set_error(state, error);
+        return false;
+    }
+
+    // the file already has its final size,
+    // so we overwrite it instead of truncating it
+    outputStream.open(entry.TargetPath, std::ios::in | std::ios::out | std::ios::binary);
+    if (!outputStream.is_open())
+    {
+        unzCloseCurrentFile(zipFile);
+        error = "CoreUnzip: failed to open file!";
+        error += entry.TargetPath.string();
+        unzip_set_error(state, error);
+        return false;
+    }
+
+    do
+    {
+        bytesRead = unzReadCurrentFile(zipFile, readBuffer, UNZIP_READ_SIZE);
+        if (bytesRead < 0)
+        {
+            unzCloseCurrentFile(zipFile);
+            unzip_set_error(state, "CoreUnzip: unzReadCurrentFile Failed!");
+            return false;
+        }
+        else if (bytesRead > 0)
+        { // write data to file
+            outputStream.write(readBuffer, bytesRead);
+            bytesWritten += bytesRead;
+            state.ExtractedBytes += bytesRead;
+        }
+    } while (bytesRead > 0 && !state.Failed);
+
+    outputStream.close();
+
+    // unzCloseCurrentFile verifies the CRC
+    // when the whole entry has been read
+    if (unzCloseCurrentFile(zipFile) != UNZ_OK && !state.Failed)
+    {
+        unzip_set_error(state, "CoreUnzip: unzCloseCurrentFile Failed!");
+        return false;
+    }
+
+    if (!state.Failed && (outputStream.fail() || bytesWritten != entry.Size))
+    {
+        error = "CoreUnzip: failed to write file!";
+        error += entry.TargetPath.string();
+        unzip_set_error(state, error);
         return false;
     }
 
-    zipFile = unzOpen(file.string().c_str());
+    return !state.Failed;
+}
+
+static void unzip_thread(UnzipState* state)
+{
+    unzFile zipFile;
+    char*   readBuffer;
+    size_t  index;
+
+    readBuffer = (char*)malloc(UNZIP_READ_SIZE);
+    if (readBuffer == nullptr)
+    {
+        unzip_set_error(*state, "CoreUnzip: malloc Failed!");
+    }
+    else
+    {
+        // every thread needs its own handle,
+        // because the handle keeps track of
+        // the current entry
+        zipFile = unzOpen64(state->File.string().c_str());
+        if (zipFile == nullptr)
+        {
+            unzip_set_error(*state, "CoreUnzip: unzOpen64 Failed!");
+        }
+        else
+        {
+            while (!state->Failed &&
+                (index = state->NextEntry++) < state->Entries.size())
+            {
+                unzip_extract_entry(*state, zipFile, readBuffer, state->Entries[index]);
+            }
+
+            unzClose(zipFile);
+        }
+
+        free(readBuffer);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state->Mutex);
+        state->FinishedThreads++;
+    }
+    state->Condition.notify_one();
+}
+
+//
+// Exported Functions
+//
+
+bool CoreUnzip(std::filesystem::path file, std::filesystem::path path, std::function<void(uint64_t, uint64_t)> progressCallback)
+{
+    std::string error;
+
+    UnzipState                      state;
+    std::set<std::filesystem::path> directories;
+    std::vector<std::thread>        threads;
+    uint64_t                        totalBytes = 0;
+    int                             threadCount;
+
+    unzFile           zipFile;
+    unz_global_info64 zipInfo;
+
+    zipFile = unzOpen64(file.string().c_str());
     if (zipFile == nullptr)
     {
-        free(read_buffer);
-        error = "CoreUnzip: unzOpen Failed!";
+        error = "CoreUnzip: unzOpen64 Failed!";
         CoreSetError(error);
         return false;
     }
 
-    if (unzGetGlobalInfo(zipFile, &zipInfo) != UNZ_OK)
+    if (unzGetGlobalInfo64(zipFile, &zipInfo) != UNZ_OK)
     {
-        free(read_buffer);
-        error = "CoreUnzip: unzGetGlobalInfo Failed!";
+        unzClose(zipFile);
+        error = "CoreUnzip: unzGetGlobalInfo64 Failed!";
         CoreSetError(error);
         return false;
     }
 
-
-    for (int i = 0; i < zipInfo.number_entry; i++)
+    // retrieve the entries first, so the directories
+    // can be created once and the files can be
+    // extracted in any order
+    for (uint64_t i = 0; i < zipInfo.number_entry; i++)
     {
-        unz_file_info fileInfo;
-        char          fileName[PATH_MAX];
+        unz_file_info64       fileInfo;
+        char                  fileName[PATH_MAX];
         std::filesystem::path targetPath;
+        UnzipEntry            entry;
 
         // ensure we can retrieve the current file info
-        if (unzGetCurrentFileInfo(zipFile, &fileInfo, fileName, PATH_MAX, nullptr, 0, nullptr, 0) != UNZ_OK)
+        if (unzGetCurrentFileInfo64(zipFile, &fileInfo, fileName, PATH_MAX, nullptr, 0, nullptr, 0) != UNZ_OK)
         {
-            free(read_buffer);
             unzClose(zipFile);
-            error = "CoreUnzip: unzGetCurrentFileInfo Failed!";
+            error = "CoreUnzip: unzGetCurrentFileInfo64 Failed!";
             CoreSetError(error);
             return false;
         }
@@ -82,68 +258,23 @@ bool CoreUnzip(std::filesystem::path file, std::filesystem::path path)
 
         if (targetPath.string().ends_with("/"))
         { // directory
-            try
-            {
-                if (!std::filesystem::is_directory(targetPath) && 
-                    !std::filesystem::create_directory(targetPath))
-                {
-                    throw std::exception();
-                }
-            }
-            catch (...)
-            {
-                free(read_buffer);
-                unzClose(zipFile);
-                error = "CoreUnzip: std::filesystem::create_directory(";
-                error += targetPath.string();
-                error += ") Failed!";
-                CoreSetError(error);
-                return false;
-            }
+            directories.insert(targetPath.parent_path());
         }
         else
         { // file
-            if (unzOpenCurrentFile(zipFile) != UNZ_OK)
-            {
-                free(read_buffer);
-                unzClose(zipFile);
-                error = "CoreUnzip: unzOpenCurrentFile Failed!";
-                CoreSetError(error);
-                return false;
-            }
-
-            outputStream.open(targetPath, std::ios::trunc | std::ios::binary);
-            if (!outputStream.is_open())
+            if (unzGetFilePos64(zipFile, &entry.Position) != UNZ_OK)
             {
-                free(read_buffer);
-                unzCloseCurrentFile(zipFile);
                 unzClose(zipFile);
-                error = "CoreUnzip: failed to open file!";
-                error += targetPath.string();
+                error = "CoreUnzip: unzGetFilePos64 Failed!";
                 CoreSetError(error);
                 return false;
             }
 
-            do    
-            {
-                bytes_read = unzReadCurrentFile(zipFile, read_buffer, UNZIP_READ_SIZE);
-                if (bytes_read < 0)
-                {
-                    free(read_buffer);
-                    unzCloseCurrentFile(zipFile);
-                    unzClose(zipFile);
-                    error = "CoreUnzip: unzReadCurrentFile Failed!";
-                    CoreSetError(error);
-                    return false;
-                }
-                else
-                { // write data to file
-                    outputStream.write(read_buffer, bytes_read);
-                }
-            } while (bytes_read > 0);
-
-            outputStream.close();
-            unzCloseCurrentFile(zipFile);
+            entry.TargetPath = targetPath;
+            entry.Size       = fileInfo.uncompressed_size;
+            totalBytes      += fileInfo.uncompressed_size;
+            directories.insert(targetPath.parent_path());
+            state.Entries.push_back(entry);
         }
 
         // break when we've iterated over all entries
@@ -155,7 +286,6 @@ bool CoreUnzip(std::filesystem::path file, std::filesystem::path path)
         // move to next file
         if (unzGoToNextFile(zipFile) != UNZ_OK)
         {
-            free(read_buffer);
             unzClose(zipFile);
             error = "CoreUnzip: unzGoToNextFile Failed!";
             CoreSetError(error);
@@ -164,6 +294,69 @@ bool CoreUnzip(std::filesystem::path file, std::filesystem::path path)
     }
 
     unzClose(zipFile);
-    free(read_buffer);
+
+    for (const std::filesystem::path& directory : directories)
+    {
+        try
+        {
+            std::filesystem::create_directories(directory);
+        }
+        catch (...)
+        {
+            error = "CoreUnzip: std::filesystem::create_directories(";
+            error += directory.string();
+            error += ") Failed!";
+            CoreSetError(error);
+            return false;
+        }
+    }
+
+    if (state.Entries.empty())
+    {
+        return true;
+    }
+
+    // extract the largest files first, so a single
+    // large file doesn't end up being extracted last
+    std::stable_sort(state.Entries.begin(), state.Entries.end(), [](const UnzipEntry& a, const UnzipEntry& b)
+    {
+        return a.Size > b.Size;
+    });
+
+    state.File  = file;
+    threadCount = std::clamp((int)std::thread::hardware_concurrency(), 1, UNZIP_MAX_THREADS);
+    threadCount = std::min(threadCount, (int)state.Entries.size());
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back(unzip_thread, &state);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(state.Mutex);
+        while (state.FinishedThreads < threadCount)
+        {
+            state.Condition.wait_for(lock, UNZIP_PROGRESS_INTERVAL);
+
+            if (progressCallback)
+            {
+                lock.unlock();
+                progressCallback(state.ExtractedBytes, totalBytes);
+                lock.lock();
+            }
+        }
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (state.Failed)
+    {
+        CoreSetError(state.Error);
+        return false;
+    }
+
     return true;
 }
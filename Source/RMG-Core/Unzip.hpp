@@ -11,8 +11,14 @@
 #define CORE_UNZIP_HPP
 
 #include <filesystem>
+#include <functional>
+#include <cstdint>
 
-// attempts to unzip the file to path
-bool CoreUnzip(std::filesystem::path file, std::filesystem::path path);
+// attempts to unzip the file to path,
+// the entries are extracted in parallel,
+// progressCallback is called on the calling
+// thread with the extracted & total amount of bytes
+bool CoreUnzip(std::filesystem::path file, std::filesystem::path path,
+    std::function<void(uint64_t, uint64_t)> progressCallback = nullptr);
 
-#endif // CORE_UNZIP_HPP
\ No newline at end of file
+#endif // CORE_UNZIP_HPP
@@ -31,6 +31,12 @@ bool PluginApi::Hook(m64p_dynlib_handle handle)
     HOOK_FUNC_OPT(handle, Plugin, Config2);
     HOOK_FUNC_OPT(handle, Plugin, Config2HasRomConfig);
     HOOK_FUNC(handle, Plugin, GetVersion);
+    HOOK_FUNC_OPT(handle, Plugin, GetAudioStatistics);
+    HOOK_FUNC_OPT(handle, Plugin, StartAudioCapture);
+    HOOK_FUNC_OPT(handle, Plugin, StopAudioCapture);
+    HOOK_FUNC_OPT(handle, Plugin, StartInputMovieRecording);
+    HOOK_FUNC_OPT(handle, Plugin, StartInputMoviePlayback);
+    HOOK_FUNC_OPT(handle, Plugin, StopInputMovie);
 
     this->handle = handle;
     this->hooked = true;
@@ -45,6 +51,12 @@ bool PluginApi::Unhook(void)
     UNHOOK_FUNC(Plugin, Config2);
     UNHOOK_FUNC(Plugin, Config2HasRomConfig);
     UNHOOK_FUNC(Plugin, GetVersion);
+    UNHOOK_FUNC(Plugin, GetAudioStatistics);
+    UNHOOK_FUNC(Plugin, StartAudioCapture);
+    UNHOOK_FUNC(Plugin, StopAudioCapture);
+    UNHOOK_FUNC(Plugin, StartInputMovieRecording);
+    UNHOOK_FUNC(Plugin, StartInputMoviePlayback);
+    UNHOOK_FUNC(Plugin, StopInputMovie);
 
     this->handle = nullptr;
     this->hooked = false;
@@ -37,6 +37,12 @@ class PluginApi
     ptr_PluginConfig2 Config2;
     ptr_PluginConfig2HasRomConfig Config2HasRomConfig;
     ptr_PluginGetVersion GetVersion;
+    ptr_PluginGetAudioStatistics GetAudioStatistics;
+    ptr_PluginStartAudioCapture StartAudioCapture;
+    ptr_PluginStopAudioCapture StopAudioCapture;
+    ptr_PluginStartInputMovieRecording StartInputMovieRecording;
+    ptr_PluginStartInputMoviePlayback StartInputMoviePlayback;
+    ptr_PluginStopInputMovie StopInputMovie;
 
   private:
     std::string errorMessage;
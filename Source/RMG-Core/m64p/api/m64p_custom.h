@@ -44,6 +44,104 @@ typedef int (*ptr_PluginConfig2HasRomConfig)(void);
 EXPORT int CALL PluginConfig2HasRomConfig(void);
 #endif
 
+/* PluginGetAudioStatistics(m64p_audio_statistics*)
+ *
+ * This optional function retrieves the statistics of an audio plugin,
+ * histogram buckets are bucket_width wide and the last bucket
+ * also contains every value above it
+ *
+*/
+#define M64P_AUDIO_HISTOGRAM_BUCKETS 16
+
+typedef struct
+{
+    unsigned int bucket_width;
+    unsigned int buckets[M64P_AUDIO_HISTOGRAM_BUCKETS];
+} m64p_audio_histogram;
+
+typedef struct
+{
+    unsigned long long callbacks;
+    unsigned long long underruns;
+    unsigned long long overruns;
+    unsigned long long sync_sleep_total_ms;
+    unsigned long long capture_dropped_frames;
+    m64p_audio_histogram primary_buffer_fill_ms;
+    m64p_audio_histogram resample_time_us;
+    m64p_audio_histogram callback_interval_ms;
+    m64p_audio_histogram sync_sleep_ms;
+} m64p_audio_statistics;
+
+typedef m64p_error (*ptr_PluginGetAudioStatistics)(m64p_audio_statistics*);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginGetAudioStatistics(m64p_audio_statistics*);
+#endif
+
+/* PluginStartAudioCapture(const char*)
+ *
+ * This optional function starts recording the audio output
+ * of an audio plugin, the plugin appends the file extension
+ * of the format it records in to the given path
+ *
+*/
+typedef m64p_error (*ptr_PluginStartAudioCapture)(const char*);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginStartAudioCapture(const char*);
+#endif
+
+/* PluginStopAudioCapture(void)
+ *
+ * This optional function stops recording the audio output
+ * of an audio plugin
+ *
+*/
+typedef m64p_error (*ptr_PluginStopAudioCapture)(void);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginStopAudioCapture(void);
+#endif
+
+/* PluginStartInputMovieRecording(const char*, m64p_input_movie_start)
+ *
+ * This optional function starts recording the keys returned
+ * by GetKeys of an input plugin to the given file,
+ * start describes what the recording starts from
+ *
+*/
+typedef enum
+{
+    M64P_INPUT_MOVIE_POWER_ON = 0,
+    M64P_INPUT_MOVIE_SAVE_STATE
+} m64p_input_movie_start;
+
+typedef m64p_error (*ptr_PluginStartInputMovieRecording)(const char*, m64p_input_movie_start);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginStartInputMovieRecording(const char*, m64p_input_movie_start);
+#endif
+
+/* PluginStartInputMoviePlayback(const char*, m64p_input_movie_start)
+ *
+ * This optional function starts playing back the input movie
+ * in the given file, GetKeys returns the recorded keys instead
+ * of reading the input devices until the movie has ended,
+ * start describes what the playback starts from
+ *
+*/
+typedef m64p_error (*ptr_PluginStartInputMoviePlayback)(const char*, m64p_input_movie_start);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginStartInputMoviePlayback(const char*, m64p_input_movie_start);
+#endif
+
+/* PluginStopInputMovie(void)
+ *
+ * This optional function stops recording or
+ * playing back the input movie of an input plugin
+ *
+*/
+typedef m64p_error (*ptr_PluginStopInputMovie)(void);
+#if defined(M64P_PLUGIN_PROTOTYPES) || defined(M64P_CORE_PROTOTYPES)
+EXPORT m64p_error CALL PluginStopInputMovie(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,4 +24,10 @@ typedef uint64_t osal_files_file_time;
 // returns -1 on failure
 osal_files_file_time osal_files_get_file_time(std::filesystem::path file);
 
+// creates or truncates the file and reserves
+// size bytes of disk space for it, the file
+// will be size bytes long afterwards,
+// returns false on failure
+bool osal_files_preallocate_file(std::filesystem::path file, uint64_t size);
+
 #endif // OSAL_FILES_HPP
@@ -10,6 +10,9 @@
 #include "osal_files.hpp"
 
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
 
 osal_files_file_time osal_files_get_file_time(std::filesystem::path file)
 {
@@ -24,3 +27,35 @@ osal_files_file_time osal_files_get_file_time(std::filesystem::path file)
 
     return file_stat.st_mtime;
 }
+
+bool osal_files_preallocate_file(std::filesystem::path file, uint64_t size)
+{
+    int fd;
+    int ret;
+
+    fd = open(file.string().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    if (size > 0)
+    {
+#ifdef __APPLE__
+        ret = ftruncate(fd, size);
+#else // Linux
+        ret = posix_fallocate(fd, 0, size);
+        if (ret == EOPNOTSUPP || ret == EINVAL)
+        { // the filesystem doesn't support it
+            ret = ftruncate(fd, size);
+        }
+#endif // __APPLE__
+        if (ret != 0)
+        {
+            close(fd);
+            return false;
+        }
+    }
+
+    return close(fd) == 0;
+}
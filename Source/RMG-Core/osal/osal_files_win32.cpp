@@ -42,3 +42,32 @@ osal_files_file_time osal_files_get_file_time(std::filesystem::path file)
 
     return ularge_int.QuadPart;
 }
+
+bool osal_files_preallocate_file(std::filesystem::path file, uint64_t size)
+{
+    BOOL ret;
+    HANDLE file_handle;
+    LARGE_INTEGER large_int;
+
+    file_handle = CreateFileW(file.wstring().c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    large_int.QuadPart = size;
+
+    ret = SetFilePointerEx(file_handle, large_int, nullptr, FILE_BEGIN);
+    if (ret == TRUE)
+    {
+        ret = SetEndOfFile(file_handle);
+    }
+
+    if (ret != TRUE)
+    {
+        CloseHandle(file_handle);
+        return false;
+    }
+
+    return CloseHandle(file_handle) == TRUE;
+}
@@ -0,0 +1,646 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Headless benchmark of the GetKeys evaluation, drives an SDL virtual
+// joystick with random states and compares the per-mapping SDL queries
+// GetKeys used to do with the compiled mapping table.
+//
+// usage: RMG-Input-Benchmark [--json] [--states N] [--iterations N]
+//
+// returns non-zero when a button differs, or when an analog
+// stick axis differs by more than 1 for any of the tested
+// deadzone and sensitivity combinations
+
+#include "Utilities/InputDeviceState.hpp"
+#include "Utilities/InputMappingTable.hpp"
+#include "common.hpp"
+
+#include <RMG-Core/m64p/api/m64p_plugin.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+//
+// Local Defines
+//
+
+#define N64_AXIS_PEAK      85
+#define MAX_DIAGONAL_VALUE 69
+
+#define VIRTUAL_AXES    SDL_CONTROLLER_AXIS_MAX
+#define VIRTUAL_BUTTONS 15
+
+// maximum difference allowed between the analog stick
+// values of the reference and the compiled table,
+// caused by the fixed point precision
+#define MAX_AXIS_DIFFERENCE 1
+
+// amount of analog stick positions tested around
+// the edge of the circle for every stick response
+#define EDGE_ANGLES  720
+#define EDGE_OFFSETS 16
+
+//
+// Local Structures
+//
+
+struct InputMapping
+{
+    std::vector<int> Type;
+    std::vector<int> Data;
+    std::vector<int> ExtraData;
+    int              Count = 0;
+};
+
+struct BenchmarkProfile
+{
+    int DeadzoneValue    = 9;
+    int SensitivityValue = 100;
+
+    InputMapping Buttons[(int)N64ControllerButton::Invalid];
+    InputMapping AnalogStick[4];
+};
+
+struct StickResponse
+{
+    int DeadzoneValue;
+    int SensitivityValue;
+};
+
+struct BenchmarkResult
+{
+    std::string Name;
+    double NanosecondsPerCall;
+};
+
+//
+// Local Variables
+//
+
+static bool l_KeyboardState[SDL_NUM_SCANCODES];
+
+// deadzone and sensitivity combinations which are
+// compared against the reference implementation
+static const StickResponse l_StickResponses[] =
+{
+    { 0,  100 },
+    { 9,  100 },
+    { 15, 100 },
+    { 50, 100 },
+    { 9,  50  },
+    { 15, 80  },
+    { 9,  125 },
+    { 15, 150 },
+    { 30, 200 },
+};
+
+//
+// Local Functions
+//
+
+static void add_mapping(InputMapping& mapping, InputType type, int data, int extraData = 0)
+{
+    mapping.Type.push_back((int)type);
+    mapping.Data.push_back(data);
+    mapping.ExtraData.push_back(extraData);
+    mapping.Count++;
+}
+
+// a typical profile for a modern gamepad,
+// with a keyboard fallback for some buttons
+static void setup_profile(BenchmarkProfile& profile)
+{
+    InputMapping* buttons = profile.Buttons;
+    InputMapping* stick   = profile.AnalogStick;
+
+    add_mapping(buttons[(int)N64ControllerButton::A], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_A);
+    add_mapping(buttons[(int)N64ControllerButton::A], InputType::Keyboard, 4 /* SDL_SCANCODE_A */);
+    add_mapping(buttons[(int)N64ControllerButton::B], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_X);
+    add_mapping(buttons[(int)N64ControllerButton::B], InputType::Keyboard, 5 /* SDL_SCANCODE_B */);
+    add_mapping(buttons[(int)N64ControllerButton::Start], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_START);
+    add_mapping(buttons[(int)N64ControllerButton::DpadUp], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_DPAD_UP);
+    add_mapping(buttons[(int)N64ControllerButton::DpadDown], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_DPAD_DOWN);
+    add_mapping(buttons[(int)N64ControllerButton::DpadLeft], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_DPAD_LEFT);
+    add_mapping(buttons[(int)N64ControllerButton::DpadRight], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_DPAD_RIGHT);
+    add_mapping(buttons[(int)N64ControllerButton::CButtonUp], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_RIGHTY, 0);
+    add_mapping(buttons[(int)N64ControllerButton::CButtonDown], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_RIGHTY, 1);
+    add_mapping(buttons[(int)N64ControllerButton::CButtonLeft], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_RIGHTX, 0);
+    add_mapping(buttons[(int)N64ControllerButton::CButtonRight], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_RIGHTX, 1);
+    add_mapping(buttons[(int)N64ControllerButton::LeftTrigger], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_LEFTSHOULDER);
+    add_mapping(buttons[(int)N64ControllerButton::RightTrigger], InputType::GamepadButton, SDL_CONTROLLER_BUTTON_RIGHTSHOULDER);
+    add_mapping(buttons[(int)N64ControllerButton::ZTrigger], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_TRIGGERLEFT, 1);
+    add_mapping(buttons[(int)N64ControllerButton::ZTrigger], InputType::JoystickButton, 7);
+
+    add_mapping(stick[(int)InputAxisDirection::Up], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_LEFTY, 0);
+    add_mapping(stick[(int)InputAxisDirection::Up], InputType::Keyboard, 82 /* SDL_SCANCODE_UP */);
+    add_mapping(stick[(int)InputAxisDirection::Down], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_LEFTY, 1);
+    add_mapping(stick[(int)InputAxisDirection::Down], InputType::Keyboard, 81 /* SDL_SCANCODE_DOWN */);
+    add_mapping(stick[(int)InputAxisDirection::Left], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_LEFTX, 0);
+    add_mapping(stick[(int)InputAxisDirection::Left], InputType::Keyboard, 80 /* SDL_SCANCODE_LEFT */);
+    add_mapping(stick[(int)InputAxisDirection::Right], InputType::GamepadAxis, SDL_CONTROLLER_AXIS_LEFTX, 1);
+    add_mapping(stick[(int)InputAxisDirection::Right], InputType::Keyboard, 79 /* SDL_SCANCODE_RIGHT */);
+}
+
+static void compile_profile(const BenchmarkProfile& profile, Utilities::InputMappingTable& table)
+{
+    table.Clear();
+
+    for (int i = 0; i < (int)N64ControllerButton::Invalid; i++)
+    {
+        const InputMapping& mapping = profile.Buttons[i];
+        table.AddButtonMapping((N64ControllerButton)i, mapping.Type, mapping.Data, mapping.ExtraData, mapping.Count);
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        const InputMapping& mapping = profile.AnalogStick[i];
+        table.AddAxisMapping((InputAxisDirection)i, mapping.Type, mapping.Data, mapping.ExtraData, mapping.Count);
+    }
+
+    table.SetAnalogStickResponse(profile.DeadzoneValue, profile.SensitivityValue);
+}
+
+//
+// Reference implementation, this is how GetKeys
+// evaluated the profile before the mapping table
+//
+
+static int reference_button_state(SDL_Joystick* joystick, SDL_GameController* gameController, const InputMapping* inputMapping)
+{
+    int state = 0;
+
+    for (int i = 0; i < inputMapping->Count; i++)
+    {
+        const int data = inputMapping->Data.at(i);
+        const int extraData = inputMapping->ExtraData.at(i);
+
+        switch ((InputType)inputMapping->Type[i])
+        {
+            case InputType::GamepadButton:
+            {
+                state |= SDL_GameControllerGetButton(gameController, (SDL_GameControllerButton)data);
+            } break;
+            case InputType::GamepadAxis:
+            {
+                int axis_value = SDL_GameControllerGetAxis(gameController, (SDL_GameControllerAxis)data);
+                state |= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
+            } break;
+            case InputType::JoystickButton:
+            {
+                state |= SDL_JoystickGetButton(joystick, data);
+            } break;
+            case InputType::JoystickAxis:
+            {
+                int axis_value = SDL_JoystickGetAxis(joystick, data);
+                state |= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
+            } break;
+            case InputType::Keyboard:
+            {
+                state |= l_KeyboardState[data] ? 1 : 0;
+            } break;
+            default:
+                break;
+        }
+    }
+
+    return state;
+}
+
+static double reference_axis_state(SDL_Joystick* joystick, SDL_GameController* gameController, const InputMapping* inputMapping, const int direction, const double value, bool& useButtonMapping)
+{
+    double axis_state   = value;
+    bool   button_state = false;
+
+    for (int i = 0; i < inputMapping->Count; i++)
+    {
+        const int data = inputMapping->Data.at(i);
+        const int extraData = inputMapping->ExtraData.at(i);
+
+        switch ((InputType)inputMapping->Type[i])
+        {
+            case InputType::GamepadButton:
+            {
+                button_state |= SDL_GameControllerGetButton(gameController, (SDL_GameControllerButton)data);
+            } break;
+            case InputType::GamepadAxis:
+            {
+                double axis_value = SDL_GameControllerGetAxis(gameController, (SDL_GameControllerAxis)data);
+                if (extraData ? axis_value > 0 : axis_value < 0)
+                {
+                    axis_value = (axis_value / SDL_AXIS_PEAK);
+                    axis_value = std::abs(axis_value) * direction;
+                    axis_state = axis_value;
+                }
+            } break;
+            case InputType::JoystickButton:
+            {
+                button_state |= SDL_JoystickGetButton(joystick, data);
+            } break;
+            case InputType::JoystickAxis:
+            {
+                double axis_value = SDL_JoystickGetAxis(joystick, data);
+                if (extraData ? axis_value > 0 : axis_value < 0)
+                {
+                    axis_value = (axis_value / SDL_AXIS_PEAK);
+                    axis_value = std::abs(axis_value) * direction;
+                    axis_state = axis_value;
+                }
+            } break;
+            case InputType::Keyboard:
+            {
+                button_state |= l_KeyboardState[data];
+            } break;
+            default:
+                break;
+        }
+    }
+
+    if (button_state)
+    {
+        useButtonMapping = true;
+        return direction;
+    }
+    else if (!useButtonMapping)
+    {
+        return axis_state;
+    }
+    else
+    {
+        return value;
+    }
+}
+
+static double reference_deadzone(const double n64InputAxis, const double maxAxis, const int deadzone, const double axisRange)
+{
+    double axisAbsolute = std::abs(n64InputAxis);
+
+    if (axisAbsolute <= deadzone)
+    {
+        axisAbsolute = 0;
+    }
+    else
+    {
+        axisAbsolute = (axisAbsolute - deadzone) * maxAxis / axisRange / axisAbsolute;
+    }
+
+    return axisAbsolute;
+}
+
+static void reference_octagon(const double inputX, const double inputY, const double deadzoneFactor, const double sensitivityFactor, int& outputX, int& outputY)
+{
+    const double maxAxis     = N64_AXIS_PEAK * std::min(sensitivityFactor, 1.0);
+    const double maxDiagonal = MAX_DIAGONAL_VALUE * std::min(sensitivityFactor, 1.0);
+    const int    deadzone    = (int)(deadzoneFactor * N64_AXIS_PEAK * sensitivityFactor);
+    const double axisRange   = maxAxis - deadzone;
+    // GetKeys used std::min() here, which didn't clamp left & down
+    // at sensitivities above 100%, the compiled table clamps
+    // both sides on purpose, so the reference does too
+    double ax = std::clamp(inputX * sensitivityFactor, -1.0, 1.0) * maxAxis;
+    double ay = std::clamp(inputY * sensitivityFactor, -1.0, 1.0) * maxAxis;
+
+    double len = std::sqrt(ax*ax + ay*ay);
+    if (len <= maxAxis)
+    {
+        ax *= reference_deadzone(ax, maxAxis, deadzone, axisRange);
+        ay *= reference_deadzone(ay, maxAxis, deadzone, axisRange);
+    }
+    else
+    {
+        len = maxAxis / len;
+        ax *= len;
+        ay *= len;
+    }
+
+    if (ax != 0.0 && ay != 0.0)
+    {
+        const double slope = ay / ax;
+        double edgex = std::copysign(maxAxis / (std::abs(slope) + (maxAxis - maxDiagonal) / maxDiagonal), ax);
+        const double edgey = std::copysign(std::min(std::abs(edgex * slope), maxAxis / (1.0 / std::abs(slope) + (maxAxis - maxDiagonal) / maxDiagonal)), ay);
+        edgex = edgey / slope;
+
+        const double scale = std::sqrt(edgex*edgex + edgey*edgey) / maxAxis;
+        ax *= scale;
+        ay *= scale;
+    }
+
+    outputX = (int)ax;
+    outputY = (int)ay;
+}
+
+static uint32_t reference_get_keys(SDL_Joystick* joystick, SDL_GameController* gameController, const BenchmarkProfile& profile)
+{
+    static const int buttonBits[] = { 7, 6, 4, 3, 2, 1, 0, 11, 10, 9, 8, 13, 12, 5 };
+    BUTTONS keys;
+    keys.Value = 0;
+
+    for (int i = 0; i < (int)N64ControllerButton::Invalid; i++)
+    {
+        keys.Value |= (uint32_t)reference_button_state(joystick, gameController, &profile.Buttons[i]) << buttonBits[i];
+    }
+
+    double inputX = 0, inputY = 0;
+    bool useButtonMapping = false;
+    inputY = reference_axis_state(joystick, gameController, &profile.AnalogStick[(int)InputAxisDirection::Up],    1, inputY, useButtonMapping);
+    inputY = reference_axis_state(joystick, gameController, &profile.AnalogStick[(int)InputAxisDirection::Down], -1, inputY, useButtonMapping);
+    inputX = reference_axis_state(joystick, gameController, &profile.AnalogStick[(int)InputAxisDirection::Left], -1, inputX, useButtonMapping);
+    inputX = reference_axis_state(joystick, gameController, &profile.AnalogStick[(int)InputAxisDirection::Right], 1, inputX, useButtonMapping);
+
+    int octagonX = 0, octagonY = 0;
+    reference_octagon(inputX, inputY, profile.DeadzoneValue / 100.0, profile.SensitivityValue / 100.0, octagonX, octagonY);
+
+    keys.X_AXIS = octagonX;
+    keys.Y_AXIS = octagonY;
+    return keys.Value;
+}
+
+//
+// Virtual Joystick
+//
+
+static bool open_virtual_joystick(int& deviceIndex, SDL_Joystick*& joystick, SDL_GameController*& gameController)
+{
+    char guid[64];
+    std::string mapping;
+
+    deviceIndex = SDL_JoystickAttachVirtual(SDL_JOYSTICK_TYPE_GAMECONTROLLER, VIRTUAL_AXES, VIRTUAL_BUTTONS, 0);
+    if (deviceIndex < 0)
+    {
+        fprintf(stderr, "SDL_JoystickAttachVirtual failed: %s\n", SDL_GetError());
+        return false;
+    }
+
+    // make sure the layout matches the SDL_GameControllerButton
+    // and SDL_GameControllerAxis order
+    SDL_JoystickGetGUIDString(SDL_JoystickGetDeviceGUID(deviceIndex), guid, sizeof(guid));
+    mapping = guid;
+    mapping += ",RMG-Input Benchmark,a:b0,b:b1,x:b2,y:b3,back:b4,guide:b5,start:b6,"
+               "leftstick:b7,rightstick:b8,leftshoulder:b9,rightshoulder:b10,"
+               "dpup:b11,dpdown:b12,dpleft:b13,dpright:b14,"
+               "leftx:a0,lefty:a1,rightx:a2,righty:a3,lefttrigger:a4,righttrigger:a5,";
+    SDL_GameControllerAddMapping(mapping.c_str());
+
+    joystick = SDL_JoystickOpen(deviceIndex);
+    gameController = SDL_GameControllerOpen(deviceIndex);
+    if (joystick == nullptr || gameController == nullptr)
+    {
+        fprintf(stderr, "failed to open virtual joystick: %s\n", SDL_GetError());
+        return false;
+    }
+
+    return true;
+}
+
+static void randomize_state(std::mt19937& rng, SDL_Joystick* joystick)
+{
+    // most of the time, only a few buttons are held
+    for (int i = 0; i < VIRTUAL_BUTTONS; i++)
+    {
+        SDL_JoystickSetVirtualButton(joystick, i, (rng() % 8) == 0 ? 1 : 0);
+    }
+
+    for (int i = 0; i < VIRTUAL_AXES; i++)
+    {
+        SDL_JoystickSetVirtualAxis(joystick, i, (Sint16)((int)(rng() % 65536) - 32768));
+    }
+
+    for (int scancode : { 4, 5, 79, 80, 81, 82 })
+    {
+        l_KeyboardState[scancode] = (rng() % 16) == 0;
+    }
+
+    SDL_JoystickUpdate();
+}
+
+static void set_stick_position(SDL_Joystick* joystick, int x, int y)
+{
+    SDL_JoystickSetVirtualAxis(joystick, SDL_CONTROLLER_AXIS_LEFTX, (Sint16)std::clamp(x, -32768, 32767));
+    SDL_JoystickSetVirtualAxis(joystick, SDL_CONTROLLER_AXIS_LEFTY, (Sint16)std::clamp(y, -32768, 32767));
+    SDL_JoystickUpdate();
+}
+
+static int get_axis_difference(uint32_t referenceKeys, uint32_t tableKeys)
+{
+    BUTTONS reference, compiled;
+    reference.Value = referenceKeys;
+    compiled.Value  = tableKeys;
+
+    return std::max(std::abs(reference.X_AXIS - compiled.X_AXIS),
+                    std::abs(reference.Y_AXIS - compiled.Y_AXIS));
+}
+
+// compares the analog stick around the edge of the circle,
+// where the deadzone stops being applied, random states
+// rarely end up there
+static int compare_stick_edge(SDL_Joystick* joystick, SDL_GameController* gameController, const BenchmarkProfile& profile, const Utilities::InputMappingTable& table)
+{
+    const double radius = SDL_AXIS_PEAK * std::min(1.0, 100.0 / std::max(profile.SensitivityValue, 1));
+    int maxAxisDifference = 0;
+
+    for (int angle = 0; angle < EDGE_ANGLES; angle++)
+    {
+        const double radians = angle * (2.0 * M_PI / EDGE_ANGLES);
+
+        for (int offset = -EDGE_OFFSETS; offset <= EDGE_OFFSETS; offset++)
+        {
+            set_stick_position(joystick,
+                (int)std::lround((radius + offset) * std::cos(radians)),
+                (int)std::lround((radius + offset) * std::sin(radians)));
+
+            const Utilities::InputDeviceState deviceState = Utilities::ReadInputDeviceState(joystick, gameController);
+            maxAxisDifference = std::max(maxAxisDifference, get_axis_difference(
+                reference_get_keys(joystick, gameController, profile), table.Evaluate(deviceState, l_KeyboardState)));
+        }
+    }
+
+    return maxAxisDifference;
+}
+
+//
+// Benchmark
+//
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    int states = 256;
+    int iterations = 20000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            json = true;
+        }
+        else if (strcmp(argv[i], "--states") == 0 && (i + 1) < argc)
+        {
+            states = std::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--iterations") == 0 && (i + 1) < argc)
+        {
+            iterations = std::max(1, atoi(argv[++i]));
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--states N] [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // we don't need a video or audio device
+    if (SDL_Init(SDL_INIT_JOYSTICK | SDL_INIT_GAMECONTROLLER) != 0)
+    {
+        fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    int deviceIndex;
+    SDL_Joystick* joystick = nullptr;
+    SDL_GameController* gameController = nullptr;
+    if (!open_virtual_joystick(deviceIndex, joystick, gameController))
+    {
+        SDL_Quit();
+        return 1;
+    }
+
+    BenchmarkProfile profile;
+    Utilities::InputMappingTable table;
+    setup_profile(profile);
+    compile_profile(profile, table);
+
+    BenchmarkProfile responseProfiles[std::size(l_StickResponses)];
+    Utilities::InputMappingTable responseTables[std::size(l_StickResponses)];
+    for (size_t i = 0; i < std::size(l_StickResponses); i++)
+    {
+        setup_profile(responseProfiles[i]);
+        responseProfiles[i].DeadzoneValue    = l_StickResponses[i].DeadzoneValue;
+        responseProfiles[i].SensitivityValue = l_StickResponses[i].SensitivityValue;
+        compile_profile(responseProfiles[i], responseTables[i]);
+    }
+
+    std::mt19937 rng(64);
+    std::chrono::steady_clock::duration referenceTime{0}, snapshotTime{0}, tableTime{0};
+    uint64_t buttonMismatches = 0;
+    int maxAxisDifference = 0;
+    // keeps the compiler from optimizing the calls away
+    uint32_t checksum = 0;
+
+    for (int state = 0; state < states; state++)
+    {
+        randomize_state(rng, joystick);
+
+        auto start = std::chrono::steady_clock::now();
+        uint32_t referenceKeys = 0;
+        for (int i = 0; i < iterations; i++)
+        {
+            referenceKeys = reference_get_keys(joystick, gameController, profile);
+            checksum += referenceKeys;
+        }
+        referenceTime += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        Utilities::InputDeviceState deviceState;
+        for (int i = 0; i < iterations; i++)
+        {
+            deviceState = Utilities::ReadInputDeviceState(joystick, gameController);
+            checksum += deviceState.GamepadButtons;
+        }
+        snapshotTime += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        uint32_t tableKeys = 0;
+        for (int i = 0; i < iterations; i++)
+        {
+            tableKeys = table.Evaluate(deviceState, l_KeyboardState);
+            checksum += tableKeys;
+        }
+        tableTime += std::chrono::steady_clock::now() - start;
+
+        if ((referenceKeys & 0xffff) != (tableKeys & 0xffff))
+        {
+            buttonMismatches++;
+        }
+
+        maxAxisDifference = std::max(maxAxisDifference, get_axis_difference(referenceKeys, tableKeys));
+
+        for (size_t i = 0; i < std::size(l_StickResponses); i++)
+        {
+            maxAxisDifference = std::max(maxAxisDifference, get_axis_difference(
+                reference_get_keys(joystick, gameController, responseProfiles[i]),
+                responseTables[i].Evaluate(deviceState, l_KeyboardState)));
+        }
+    }
+
+    // a held direction key overrides the analog stick
+    for (int scancode : { 79, 80, 81, 82 })
+    {
+        l_KeyboardState[scancode] = false;
+    }
+
+    for (size_t i = 0; i < std::size(l_StickResponses); i++)
+    {
+        const int difference = compare_stick_edge(joystick, gameController, responseProfiles[i], responseTables[i]);
+        if (difference > MAX_AXIS_DIFFERENCE)
+        {
+            fprintf(stderr, "analog stick differs by %d at deadzone %d%%, sensitivity %d%%\n",
+                difference, l_StickResponses[i].DeadzoneValue, l_StickResponses[i].SensitivityValue);
+        }
+        maxAxisDifference = std::max(maxAxisDifference, difference);
+    }
+
+    const double calls = (double)states * iterations;
+    const BenchmarkResult results[] =
+    {
+        { "per-mapping SDL queries",   std::chrono::duration<double, std::nano>(referenceTime).count() / calls },
+        { "snapshot",                  std::chrono::duration<double, std::nano>(snapshotTime).count() / calls },
+        { "compiled table",            std::chrono::duration<double, std::nano>(tableTime).count() / calls },
+        { "snapshot + compiled table", std::chrono::duration<double, std::nano>(snapshotTime + tableTime).count() / calls },
+    };
+
+    if (json)
+    {
+        printf("{\n  \"states\": %d,\n  \"iterations\": %d,\n  \"results\": [\n", states, iterations);
+        for (size_t i = 0; i < std::size(results); i++)
+        {
+            printf("    { \"name\": \"%s\", \"ns_per_call\": %.2f }%s\n", results[i].Name.c_str(),
+                results[i].NanosecondsPerCall, (i + 1) < std::size(results) ? "," : "");
+        }
+        printf("  ],\n  \"button_mismatches\": %llu,\n  \"max_axis_difference\": %d,\n  \"checksum\": %u\n}\n",
+            (unsigned long long)buttonMismatches, maxAxisDifference, checksum);
+    }
+    else
+    {
+        printf("%d states, %d iterations per state\n", states, iterations);
+        for (const BenchmarkResult& result : results)
+        {
+            printf("%-28s %10.2f ns/call\n", result.Name.c_str(), result.NanosecondsPerCall);
+        }
+        printf("button mismatches: %llu, max axis difference: %d (checksum %u)\n",
+            (unsigned long long)buttonMismatches, maxAxisDifference, checksum);
+    }
+
+    SDL_GameControllerClose(gameController);
+    SDL_JoystickClose(joystick);
+    SDL_JoystickDetachVirtual(deviceIndex);
+    SDL_Quit();
+
+    // the analog stick is allowed to differ slightly,
+    // due to the fixed point precision
+    return (buttonMismatches == 0 && maxAxisDifference <= MAX_AXIS_DIFFERENCE) ? 0 : 1;
+}
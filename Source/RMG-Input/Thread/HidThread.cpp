@@ -0,0 +1,89 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "HidThread.hpp"
+
+#include <chrono>
+
+using namespace Thread;
+
+// maximum size of an input report
+#define HID_THREAD_REPORT_SIZE 256
+
+// how long a read blocks, this is how long
+// StopLoop() has to wait at most
+#define HID_THREAD_READ_TIMEOUT_MS 50
+
+HidThread::HidThread(hid_device* device, Utilities::HidReportLayout layout,
+    std::function<void(const Utilities::InputDeviceState&)> publishStateFunc, QObject *parent) : QThread(parent)
+{
+    this->device = device;
+    this->layout = layout;
+    this->publishStateFunc = publishStateFunc;
+}
+
+HidThread::~HidThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void HidThread::StopLoop(void)
+{
+    this->keepLoopRunning = false;
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void HidThread::run(void)
+{
+    uint8_t report[HID_THREAD_REPORT_SIZE];
+    Utilities::InputDeviceState state;
+    state.Attached = true;
+
+    while (this->keepLoopRunning)
+    {
+        int size = hid_read_timeout(this->device, report, sizeof(report), HID_THREAD_READ_TIMEOUT_MS);
+        if (size < 0)
+        {
+            // the device has been disconnected,
+            // SDLThread takes care of re-opening it
+            this->publishStateFunc(Utilities::InputDeviceState());
+            break;
+        }
+
+        if (size == 0)
+        {
+            continue;
+        }
+
+        bool stateChanged = false;
+
+        // apply all reports which are already queued,
+        // so only the newest state is published and
+        // we never fall behind the device
+        do
+        {
+            stateChanged |= this->layout.ReadReport(report, (size_t)size, state);
+            size = hid_read_timeout(this->device, report, sizeof(report), 0);
+        } while (size > 0);
+
+        if (!stateChanged)
+        {
+            continue;
+        }
+
+        state.Timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        this->publishStateFunc(state);
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef HIDTHREAD_HPP
+#define HIDTHREAD_HPP
+
+#include <QThread>
+
+#include <atomic>
+#include <functional>
+#include <hidapi.h>
+
+#include "Utilities/HidReportLayout.hpp"
+#include "Utilities/InputDeviceState.hpp"
+
+namespace Thread
+{
+// reads the input reports of a HID device as soon
+// as they arrive and publishes the resulting state,
+// every snapshot contains the time at which its
+// newest report has been read
+class HidThread : public QThread
+{
+    Q_OBJECT
+public:
+    HidThread(hid_device* device, Utilities::HidReportLayout layout,
+        std::function<void(const Utilities::InputDeviceState&)> publishStateFunc, QObject *parent);
+    ~HidThread(void);
+
+    void run(void) override;
+
+    // stops reading reports, the device
+    // isn't closed by the thread
+    void StopLoop(void);
+
+private:
+    std::atomic<bool> keepLoopRunning = {true};
+
+    hid_device* device;
+    Utilities::HidReportLayout layout;
+    std::function<void(const Utilities::InputDeviceState&)> publishStateFunc;
+};
+} // namespace Thread
+
+#endif // HIDTHREAD_HPP
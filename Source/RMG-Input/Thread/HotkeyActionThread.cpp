@@ -0,0 +1,74 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "HotkeyActionThread.hpp"
+
+using namespace Thread;
+
+HotkeyActionThread::HotkeyActionThread(std::function<void(int, bool)> runActionFunc, QObject *parent) : QThread(parent)
+{
+    this->runActionFunc = runActionFunc;
+}
+
+HotkeyActionThread::~HotkeyActionThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void HotkeyActionThread::QueueAction(int hotkey, bool pressed)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->actions.push_back({hotkey, pressed});
+    }
+    this->loopCondition.notify_one();
+}
+
+void HotkeyActionThread::StopLoop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
+        this->actions.clear();
+    }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void HotkeyActionThread::run(void)
+{
+    std::unique_lock<std::mutex> lock(this->loopMutex);
+
+    while (true)
+    {
+        this->loopCondition.wait(lock, [this]()
+        {
+            return !this->keepLoopRunning || !this->actions.empty();
+        });
+
+        if (!this->keepLoopRunning)
+        {
+            break;
+        }
+
+        Action action = this->actions.front();
+        this->actions.pop_front();
+
+        // don't hold the lock while running the action,
+        // GetKeys might want to queue another one
+        lock.unlock();
+        this->runActionFunc(action.Hotkey, action.Pressed);
+        lock.lock();
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef HOTKEYACTIONTHREAD_HPP
+#define HOTKEYACTIONTHREAD_HPP
+
+#include <QThread>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace Thread
+{
+// runs the actions of hotkeys in the order
+// they've been queued, so saving a state or
+// taking a screenshot doesn't block GetKeys
+class HotkeyActionThread : public QThread
+{
+    Q_OBJECT
+public:
+    HotkeyActionThread(std::function<void(int, bool)> runActionFunc, QObject *parent);
+    ~HotkeyActionThread(void);
+
+    void run(void) override;
+
+    // queues the action of the hotkey,
+    // pressed is false when it's been released
+    void QueueAction(int hotkey, bool pressed);
+
+    // stops the thread, queued
+    // actions are dropped
+    void StopLoop(void);
+
+private:
+    struct Action
+    {
+        int  Hotkey;
+        bool Pressed;
+    };
+
+    bool keepLoopRunning = true;
+    std::function<void(int, bool)> runActionFunc;
+    std::deque<Action> actions;
+
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+};
+} // namespace Thread
+
+#endif // HOTKEYACTIONTHREAD_HPP
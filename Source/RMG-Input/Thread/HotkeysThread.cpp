@@ -11,6 +11,10 @@
 
 #include <RMG-Core/Core.hpp>
 
+#include <SDL.h>
+
+#include <chrono>
+
 using namespace Thread;
 
 HotkeysThread::HotkeysThread(std::function<void(int)> checkHotkeysFunc, QObject *parent) : QThread(parent)
@@ -28,38 +32,116 @@ HotkeysThread::~HotkeysThread()
 
 void HotkeysThread::SetState(HotkeysThreadState state)
 {
-    this->state = state;
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->state = state;
+    }
+    this->loopCondition.notify_one();
+}
+
+void HotkeysThread::NotifyInput(void)
+{
+    // the emulation thread checks the hotkeys
+    // itself when emulation isn't paused
+    if (!this->isPaused)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->hasInput = true;
+    }
+    this->loopCondition.notify_one();
 }
 
 void HotkeysThread::StopLoop(void)
 {
-    this->keepLoopRunning = false;
-    while (this->isRunning())
     {
-        // wait until we're not running anymore
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
     }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+int HotkeysThread::sdlEventWatch(void* userdata, SDL_Event* event)
+{
+    HotkeysThread* thread = (HotkeysThread*)userdata;
+
+    switch (event->type)
+    {
+        case SDL_JOYAXISMOTION:
+        case SDL_JOYHATMOTION:
+        case SDL_JOYBUTTONDOWN:
+        case SDL_JOYBUTTONUP:
+        case SDL_CONTROLLERAXISMOTION:
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            thread->NotifyInput();
+            break;
+        default:
+            break;
+    }
+
+    return 1;
 }
 
 void HotkeysThread::run(void)
 {
-    while (this->keepLoopRunning)
+    SDL_AddEventWatch(&HotkeysThread::sdlEventWatch, this);
+
+    while (true)
     {
-        // sleep for 300ms when no ROM is opened
-        if (this->state == HotkeysThreadState::RomClosed)
         {
-            QThread::msleep(300);
-            continue;
+            std::unique_lock<std::mutex> lock(this->loopMutex);
+
+            if (this->state == HotkeysThreadState::RomClosed)
+            { // sleep until a ROM has been opened
+                this->loopCondition.wait(lock, [this]()
+                {
+                    return !this->keepLoopRunning ||
+                        this->state != HotkeysThreadState::RomClosed;
+                });
+            }
+            else
+            { // we don't get notified about pause state changes,
+              // so check it every 100ms, but wake up immediately
+              // when there's input while emulation is paused
+                this->loopCondition.wait_for(lock, std::chrono::milliseconds(100), [this]()
+                {
+                    return !this->keepLoopRunning || this->hasInput ||
+                        this->state == HotkeysThreadState::RomClosed;
+                });
+            }
+
+            if (!this->keepLoopRunning)
+            {
+                break;
+            }
+
+            this->hasInput = false;
+
+            if (this->state == HotkeysThreadState::RomClosed)
+            {
+                this->isPaused = false;
+                continue;
+            }
         }
 
-        if (CoreIsEmulationPaused())
+        // the hotkey functions might change the state,
+        // so don't hold the lock while checking them
+        this->isPaused = CoreIsEmulationPaused();
+        if (this->isPaused)
         {
             for (int i = 0; i < 4; i++)
             {
                 this->checkHotkeysFunc(i);
             }
         }
-
-        // sleep for 100ms
-        QThread::msleep(100);
     }
+
+    SDL_DelEventWatch(&HotkeysThread::sdlEventWatch, this);
 }
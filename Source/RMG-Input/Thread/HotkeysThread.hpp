@@ -12,12 +12,18 @@
 
 #include <QThread>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 enum class HotkeysThreadState
 {
     RomOpened,
     RomClosed,
 };
 
+union SDL_Event;
+
 namespace Thread
 {
 class HotkeysThread : public QThread
@@ -31,13 +37,24 @@ public:
 
     void SetState(HotkeysThreadState state);
 
+    // wakes up the thread when emulation is paused,
+    // so the hotkeys are checked immediately
+    void NotifyInput(void);
+
     void StopLoop(void);
 
 private:
     bool keepLoopRunning = true;
+    bool hasInput = false;
+    std::atomic<bool> isPaused = {false};
     std::function<void(int)> checkHotkeysFunc;
     HotkeysThreadState state = HotkeysThreadState::RomClosed;
 
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+
+    // called by SDL from the thread which pumps the events
+    static int sdlEventWatch(void* userdata, SDL_Event* event);
 };
 } // namespace Thread
 
@@ -0,0 +1,119 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "InputThread.hpp"
+
+#include <RMG-Core/Core.hpp>
+
+#include <chrono>
+
+using namespace Thread;
+
+InputThread::InputThread(std::function<void(void)> pollInputFunc, QObject *parent) : QThread(parent)
+{
+    this->pollInputFunc = pollInputFunc;
+}
+
+InputThread::~InputThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void InputThread::SetState(InputThreadState state)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->state = state;
+    }
+    this->loopCondition.notify_one();
+}
+
+bool InputThread::NotifyResumed(void)
+{
+    // GetKeys calls this every frame,
+    // so avoid locking when we're polling
+    if (!this->isPaused.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->isPaused = false;
+    }
+    this->loopCondition.notify_one();
+    return true;
+}
+
+void InputThread::StopLoop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
+    }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void InputThread::run(void)
+{
+    std::unique_lock<std::mutex> lock(this->loopMutex);
+
+    while (this->keepLoopRunning)
+    {
+        // sleep until a ROM has been opened
+        if (this->state == InputThreadState::RomClosed)
+        {
+            this->loopCondition.wait(lock, [this]()
+            {
+                return !this->keepLoopRunning ||
+                    this->state != InputThreadState::RomClosed;
+            });
+            continue;
+        }
+
+        lock.unlock();
+        const bool paused = CoreIsEmulationPaused();
+        if (!paused)
+        {
+            this->pollInputFunc();
+        }
+        lock.lock();
+
+        // HotkeysThread polls the devices itself while
+        // emulation is paused, so sleep until GetKeys
+        // notifies us, we don't get notified about pause
+        // state changes otherwise, so check it every 100ms
+        if (paused)
+        {
+            this->isPaused = true;
+            this->loopCondition.wait_for(lock, std::chrono::milliseconds(100), [this]()
+            {
+                return !this->keepLoopRunning || !this->isPaused ||
+                    this->state == InputThreadState::RomClosed;
+            });
+            this->isPaused = false;
+            continue;
+        }
+
+        // poll every 1ms, this adds at most
+        // 1ms of latency compared to polling
+        // in GetKeys directly
+        this->loopCondition.wait_for(lock, std::chrono::milliseconds(1), [this]()
+        {
+            return !this->keepLoopRunning ||
+                this->state == InputThreadState::RomClosed;
+        });
+    }
+}
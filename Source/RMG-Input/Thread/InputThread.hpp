@@ -0,0 +1,58 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef INPUTTHREAD_HPP
+#define INPUTTHREAD_HPP
+
+#include <QThread>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+enum class InputThreadState
+{
+    RomOpened,
+    RomClosed,
+};
+
+namespace Thread
+{
+// polls the input devices once per tick,
+// so GetKeys only has to read their snapshots,
+// sleeps while emulation is paused
+class InputThread : public QThread
+{
+    Q_OBJECT
+public:
+    InputThread(std::function<void(void)> pollInputFunc, QObject *parent);
+    ~InputThread(void);
+
+    void run(void) override;
+
+    void SetState(InputThreadState state);
+
+    // wakes up the thread when it's sleeping because
+    // emulation was paused, returns whether it was
+    bool NotifyResumed(void);
+
+    void StopLoop(void);
+
+private:
+    bool keepLoopRunning = true;
+    std::function<void(void)> pollInputFunc;
+    InputThreadState state = InputThreadState::RomClosed;
+    std::atomic<bool> isPaused = {false};
+
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+};
+} // namespace Thread
+
+#endif // INPUTTHREAD_HPP
@@ -0,0 +1,78 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "MovieWriterThread.hpp"
+
+using namespace Thread;
+
+MovieWriterThread::MovieWriterThread(FILE* file, QObject *parent) : QThread(parent)
+{
+    this->file = file;
+}
+
+MovieWriterThread::~MovieWriterThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void MovieWriterThread::QueueData(std::vector<uint8_t> data)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->queue.push_back(std::move(data));
+    }
+    this->loopCondition.notify_one();
+}
+
+void MovieWriterThread::StopLoop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
+    }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void MovieWriterThread::run(void)
+{
+    std::vector<std::vector<uint8_t>> queue;
+    bool keepLoopRunning = true;
+
+    while (keepLoopRunning)
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->loopMutex);
+
+            this->loopCondition.wait(lock, [this]()
+            {
+                return !this->keepLoopRunning || !this->queue.empty();
+            });
+
+            // we still write the queued data
+            // when we've been asked to stop
+            keepLoopRunning = this->keepLoopRunning;
+            queue.swap(this->queue);
+        }
+
+        for (const std::vector<uint8_t>& data : queue)
+        {
+            fwrite(data.data(), 1, data.size(), this->file);
+        }
+        queue.clear();
+    }
+
+    fclose(this->file);
+    this->file = nullptr;
+}
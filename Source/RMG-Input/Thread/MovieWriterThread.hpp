@@ -0,0 +1,52 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MOVIEWRITERTHREAD_HPP
+#define MOVIEWRITERTHREAD_HPP
+
+#include <QThread>
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace Thread
+{
+// writes the data of an input movie to a file,
+// so the emulation thread never has to wait on I/O
+class MovieWriterThread : public QThread
+{
+    Q_OBJECT
+public:
+    // takes ownership of the file,
+    // it's closed when the loop has stopped
+    MovieWriterThread(FILE* file, QObject *parent);
+    ~MovieWriterThread(void);
+
+    void run(void) override;
+
+    void QueueData(std::vector<uint8_t> data);
+
+    // writes the queued data, closes
+    // the file and stops the loop
+    void StopLoop(void);
+
+private:
+    bool keepLoopRunning = true;
+    FILE* file = nullptr;
+    std::vector<std::vector<uint8_t>> queue;
+
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+};
+} // namespace Thread
+
+#endif // MOVIEWRITERTHREAD_HPP
@@ -0,0 +1,87 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "RumbleThread.hpp"
+
+using namespace Thread;
+
+RumbleThread::RumbleThread(std::function<void(bool)> applyRumbleFunc, QObject *parent) : QThread(parent)
+{
+    this->applyRumbleFunc = applyRumbleFunc;
+}
+
+RumbleThread::~RumbleThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void RumbleThread::SetRumble(bool rumble)
+{
+    // games write the same state over and over,
+    // only wake up the thread when it has changed
+    if (this->desiredRumble.exchange(rumble) == rumble)
+    {
+        return;
+    }
+
+    // take the lock so the notification can't get lost
+    // between the thread checking the state and waiting
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+    }
+    this->loopCondition.notify_one();
+}
+
+void RumbleThread::StopLoop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
+    }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void RumbleThread::run(void)
+{
+    while (true)
+    {
+        bool rumble;
+
+        {
+            std::unique_lock<std::mutex> lock(this->loopMutex);
+
+            this->loopCondition.wait(lock, [this]()
+            {
+                return !this->keepLoopRunning ||
+                    this->desiredRumble != this->appliedRumble;
+            });
+
+            if (!this->keepLoopRunning)
+            {
+                break;
+            }
+
+            rumble = this->desiredRumble;
+        }
+
+        // a state which has been turned on and off
+        // again while we were busy is skipped here
+        if (rumble != this->appliedRumble)
+        {
+            this->applyRumbleFunc(rumble);
+            this->appliedRumble = rumble;
+        }
+    }
+}
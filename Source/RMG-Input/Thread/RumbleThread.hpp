@@ -0,0 +1,52 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef RUMBLETHREAD_HPP
+#define RUMBLETHREAD_HPP
+
+#include <QThread>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace Thread
+{
+// applies the rumble state of a device,
+// so the (possibly blocking) rumble calls
+// don't happen on the emulation thread
+class RumbleThread : public QThread
+{
+    Q_OBJECT
+public:
+    RumbleThread(std::function<void(bool)> applyRumbleFunc, QObject *parent);
+    ~RumbleThread(void);
+
+    void run(void) override;
+
+    // sets the desired rumble state, only the latest
+    // state is applied, so toggling it multiple times
+    // before the thread wakes up only results in one call
+    void SetRumble(bool rumble);
+
+    void StopLoop(void);
+
+private:
+    bool keepLoopRunning = true;
+    std::function<void(bool)> applyRumbleFunc;
+
+    std::atomic<bool> desiredRumble = {false};
+    bool appliedRumble = false;
+
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+};
+} // namespace Thread
+
+#endif // RUMBLETHREAD_HPP
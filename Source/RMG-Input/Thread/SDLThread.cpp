@@ -11,6 +11,8 @@
 
 #include <SDL.h>
 
+#include <chrono>
+
 using namespace Thread;
 
 SDLThread::SDLThread(QObject *parent) : QThread(parent)
@@ -28,11 +30,25 @@ SDLThread::~SDLThread()
 
 void SDLThread::StopLoop(void)
 {
-    this->keepLoopRunning = false;
-    while (this->isRunning())
     {
-        // wait until we're not running anymore
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
     }
+    this->loopCondition.notify_one();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+std::vector<SDLDevice> SDLThread::GetCachedInputDevices(void)
+{
+    std::lock_guard<std::mutex> lock(this->inputDevicesMutex);
+    return this->inputDevices;
+}
+
+bool SDLThread::HasCachedInputDevices(void)
+{
+    return this->hasInputDevices;
 }
 
 SDLThreadAction SDLThread::GetCurrentAction(void)
@@ -42,13 +58,107 @@ SDLThreadAction SDLThread::GetCurrentAction(void)
 
 void SDLThread::SetAction(SDLThreadAction action)
 {
-    this->currentAction = action;
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->currentAction = action;
+    }
+    this->loopCondition.notify_one();
+}
+
+void SDLThread::refreshInputDevices(void)
+{
+    std::vector<SDLDevice> devices;
+    char guid[33];
+
+    for (int i = 0; i < SDL_NumJoysticks(); i++)
+    {
+        const char* name;
+
+        if (SDL_IsGameController(i))
+        {
+            name = SDL_GameControllerNameForIndex(i);
+        }
+        else
+        {
+            name = SDL_JoystickNameForIndex(i);
+        }
+
+        if (name != nullptr)
+        {
+            SDL_JoystickGetGUIDString(SDL_JoystickGetDeviceGUID(i), guid, sizeof(guid));
+
+            SDLDevice device;
+            device.Name   = name;
+            device.GUID   = guid;
+            device.Number = i;
+            devices.push_back(device);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(this->inputDevicesMutex);
+    this->inputDevices = devices;
+    this->hasInputDevices = true;
+}
+
+int SDLThread::sdlEventWatch(void* userdata, SDL_Event* event)
+{
+    SDLThread* thread = (SDLThread*)userdata;
+
+    switch (event->type)
+    {
+        case SDL_JOYDEVICEADDED:
+        case SDL_JOYDEVICEREMOVED:
+        case SDL_CONTROLLERDEVICEADDED:
+        case SDL_CONTROLLERDEVICEREMOVED:
+        case SDL_CONTROLLERDEVICEREMAPPED:
+            // only set a flag here, we don't want to
+            // enumerate the devices on the thread
+            // which pumps the events
+            {
+                std::lock_guard<std::mutex> lock(thread->loopMutex);
+                thread->inputDevicesChanged = true;
+            }
+            thread->loopCondition.notify_one();
+            break;
+        default:
+            break;
+    }
+
+    return 1;
 }
 
 void SDLThread::run(void)
 {
-    while (this->keepLoopRunning)
+    SDL_AddEventWatch(&SDLThread::sdlEventWatch, this);
+
+    while (true)
     {
+        {
+            std::unique_lock<std::mutex> lock(this->loopMutex);
+
+            const SDLThreadAction action = this->currentAction;
+            const auto hasWork = [this, action]()
+            {
+                return !this->keepLoopRunning ||
+                    this->inputDevicesChanged ||
+                    this->currentAction != action;
+            };
+
+            if (action == SDLThreadAction::SDLPumpEvents)
+            { // pump the events every 10ms
+                this->loopCondition.wait_for(lock, std::chrono::milliseconds(10), hasWork);
+            }
+            else if (action == SDLThreadAction::None)
+            { // sleep until there's something to do
+                this->loopCondition.wait(lock, hasWork);
+            }
+
+            if (!this->keepLoopRunning)
+            {
+                break;
+            }
+        }
+
         switch (this->currentAction)
         {
             default:
@@ -62,31 +172,25 @@ void SDLThread::run(void)
             {
                 // force re-fresh joystick list
                 SDL_JoystickUpdate();
+                this->refreshInputDevices();
 
-                for (int i = 0; i < SDL_NumJoysticks(); i++)
+                for (const SDLDevice& device : this->GetCachedInputDevices())
                 {
-                    const char* name;
-
-                    if (SDL_IsGameController(i))
-                    {
-                        name = SDL_GameControllerNameForIndex(i);
-                    }
-                    else
-                    {
-                        name = SDL_JoystickNameForIndex(i);
-                    }
-
-                    if (name != nullptr)
-                    {
-                        emit this->OnInputDeviceFound(QString(name), i);
-                    }
+                    emit this->OnInputDeviceFound(QString::fromStdString(device.Name), device.Number);
                 }
                 this->currentAction = SDLThreadAction::None;
                 emit this->OnDeviceSearchFinished();
             } break;
         }
 
-        // sleep for 10ms
-        QThread::msleep(10);
+        // refresh the cached input devices
+        // when we've received a hot-plug event
+        if (this->inputDevicesChanged.exchange(false))
+        {
+            this->refreshInputDevices();
+            emit this->OnInputDevicesChanged();
+        }
     }
+
+    SDL_DelEventWatch(&SDLThread::sdlEventWatch, this);
 }
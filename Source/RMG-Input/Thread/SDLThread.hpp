@@ -12,6 +12,12 @@
 
 #include <QThread>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
 enum class SDLThreadAction
 {
     None = 0,
@@ -19,6 +25,15 @@ enum class SDLThreadAction
     GetInputDevices,
 };
 
+struct SDLDevice
+{
+    std::string Name;
+    std::string GUID;
+    int Number = -1;
+};
+
+union SDL_Event;
+
 namespace Thread
 {
 class SDLThread : public QThread
@@ -35,13 +50,37 @@ public:
     SDLThreadAction GetCurrentAction(void);
     void SetAction(SDLThreadAction action);
 
+    // returns the cached list of input devices,
+    // the list is refreshed after SDL hot-plug events
+    // so it doesn't require enumerating the devices
+    std::vector<SDLDevice> GetCachedInputDevices(void);
+
+    // returns whether the cached list has been populated
+    bool HasCachedInputDevices(void);
+
 private:
     bool keepLoopRunning = true;
-    SDLThreadAction currentAction = SDLThreadAction::None;
+    std::atomic<SDLThreadAction> currentAction = {SDLThreadAction::None};
+
+    // guards keepLoopRunning and wakes up the loop
+    // when there's an action or a hot-plug event
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+
+    std::atomic<bool> inputDevicesChanged = {true};
+    std::atomic<bool> hasInputDevices = {false};
+    std::mutex inputDevicesMutex;
+    std::vector<SDLDevice> inputDevices;
+
+    void refreshInputDevices(void);
+
+    // called by SDL from the thread which pumps the events
+    static int sdlEventWatch(void* userdata, SDL_Event* event);
 
 signals:
     void OnInputDeviceFound(QString, int);
     void OnDeviceSearchFinished(void);
+    void OnInputDevicesChanged(void);
 };
 } // namespace Thread
 
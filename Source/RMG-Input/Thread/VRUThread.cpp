@@ -0,0 +1,136 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "VRUThread.hpp"
+
+#include <chrono>
+
+using namespace Thread;
+
+// interval at which the captured audio is fed
+// to the speech recognizer while listening
+#define VRU_THREAD_FEED_INTERVAL std::chrono::milliseconds(20)
+
+VRUThread::VRUThread(std::function<void(void)> loadModelFunc, std::function<void(void)> feedAudioFunc, std::function<void(void)> finishAudioFunc, QObject *parent) : QThread(parent)
+{
+    this->loadModelFunc   = loadModelFunc;
+    this->feedAudioFunc   = feedAudioFunc;
+    this->finishAudioFunc = finishAudioFunc;
+}
+
+VRUThread::~VRUThread()
+{
+    if (this->isRunning())
+    {
+        this->StopLoop();
+    }
+}
+
+void VRUThread::StartListening(void)
+{
+    {
+        std::unique_lock<std::mutex> lock(this->loopMutex);
+        this->resultCondition.wait(lock, [this]()
+        {
+            return !this->finishPending || !this->keepLoopRunning;
+        });
+        this->listening = true;
+    }
+    this->loopCondition.notify_one();
+}
+
+void VRUThread::StopListening(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        if (!this->listening)
+        {
+            return;
+        }
+        this->listening = false;
+        // the loop can't finish the result while
+        // the model is being loaded, so don't make
+        // the emulation thread wait for it
+        this->finishPending = this->modelLoaded;
+    }
+    this->loopCondition.notify_one();
+}
+
+void VRUThread::WaitForResult(void)
+{
+    std::unique_lock<std::mutex> lock(this->loopMutex);
+    this->resultCondition.wait(lock, [this]()
+    {
+        return !this->finishPending || !this->keepLoopRunning;
+    });
+}
+
+void VRUThread::StopLoop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->loopMutex);
+        this->keepLoopRunning = false;
+    }
+    this->loopCondition.notify_one();
+    this->resultCondition.notify_all();
+
+    // wait until we're not running anymore
+    this->wait();
+}
+
+void VRUThread::run(void)
+{
+    // loading the model takes a while,
+    // so it's done before anything else
+    this->loadModelFunc();
+
+    std::unique_lock<std::mutex> lock(this->loopMutex);
+    this->modelLoaded = true;
+
+    while (true)
+    {
+        if (this->listening)
+        {
+            this->loopCondition.wait_for(lock, VRU_THREAD_FEED_INTERVAL, [this]()
+            {
+                return !this->keepLoopRunning || !this->listening;
+            });
+        }
+        else
+        {
+            this->loopCondition.wait(lock, [this]()
+            {
+                return !this->keepLoopRunning || this->listening || this->finishPending;
+            });
+        }
+
+        if (!this->keepLoopRunning)
+        {
+            break;
+        }
+
+        // don't hold the lock while the recognizer
+        // runs, so the emulation thread isn't blocked
+        if (this->listening)
+        {
+            lock.unlock();
+            this->feedAudioFunc();
+            lock.lock();
+        }
+        else if (this->finishPending)
+        {
+            lock.unlock();
+            this->finishAudioFunc();
+            lock.lock();
+
+            this->finishPending = false;
+            this->resultCondition.notify_all();
+        }
+    }
+}
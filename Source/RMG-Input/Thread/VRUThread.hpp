@@ -0,0 +1,64 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef VRUTHREAD_HPP
+#define VRUTHREAD_HPP
+
+#include <QThread>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace Thread
+{
+// loads the speech recognition model and feeds
+// the captured audio to the speech recognizer
+// while the mic is held, so ReadVRUResults only has
+// to pick up the result once the mic is released
+class VRUThread : public QThread
+{
+    Q_OBJECT
+public:
+    VRUThread(std::function<void(void)> loadModelFunc, std::function<void(void)> feedAudioFunc, std::function<void(void)> finishAudioFunc, QObject *parent);
+    ~VRUThread(void);
+
+    void run(void) override;
+
+    // starts feeding audio, waits until
+    // the previous result has been finished
+    void StartListening(void);
+
+    // stops feeding audio, the result is finished
+    // in the background, there's no result to finish
+    // while the model is still being loaded
+    void StopListening(void);
+
+    // waits until the result of the
+    // last listening session is finished
+    void WaitForResult(void);
+
+    void StopLoop(void);
+
+private:
+    bool keepLoopRunning = true;
+    bool listening       = false;
+    bool finishPending   = false;
+    bool modelLoaded     = false;
+
+    std::function<void(void)> loadModelFunc;
+    std::function<void(void)> feedAudioFunc;
+    std::function<void(void)> finishAudioFunc;
+
+    std::mutex loopMutex;
+    std::condition_variable loopCondition;
+    std::condition_variable resultCondition;
+};
+} // namespace Thread
+
+#endif // VRUTHREAD_HPP
@@ -380,6 +380,24 @@ void MainDialog::on_EventFilter_KeyReleased(QKeyEvent *event)
     SDL_PeepEvents(&sdlEvent, 1, SDL_ADDEVENT, 0, 0);
 }
 
+QList<QString> MainDialog::GetSavedSections(void)
+{
+    QList<QString> sections;
+
+    for (auto& controllerWidget : this->controllerWidgets)
+    {
+        for (const QString& section : controllerWidget->GetSavedSections())
+        {
+            if (!sections.contains(section))
+            {
+                sections.append(section);
+            }
+        }
+    }
+
+    return sections;
+}
+
 void MainDialog::accept(void)
 {
     Widget::ControllerWidget* controllerWidget;
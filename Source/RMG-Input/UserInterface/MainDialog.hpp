@@ -62,6 +62,9 @@ public:
     MainDialog(QWidget *parent, Thread::SDLThread*, bool);
     ~MainDialog(void);
 
+    // returns the sections which have been saved
+    QList<QString> GetSavedSections(void);
+
 public slots:
     void on_InputPollTimer_triggered();
 
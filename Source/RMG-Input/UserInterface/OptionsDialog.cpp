@@ -23,10 +23,17 @@ OptionsDialog::OptionsDialog(QWidget* parent, OptionsDialogSettings settings) :
     this->controllerPakComboBox->setCurrentIndex(settings.ControllerPak);
     this->gameboyRomLineEdit->setText(QString::fromStdString(settings.GameboyRom));
     this->gameboySaveLineEdit->setText(QString::fromStdString(settings.GameboySave));
+    this->useRawHidCheckBox->setChecked(settings.UseRawHid);
+    this->measureHidLatencyCheckBox->setChecked(settings.MeasureHidLatency);
     this->removeDuplicateMappingsCheckbox->setChecked(settings.RemoveDuplicateMappings);
     this->filterEventsForButtonsCheckBox->setChecked(settings.FilterEventsForButtons);
     this->filterEventsForAxisCheckBox->setChecked(settings.FilterEventsForAxis);
 
+#ifndef HIDAPI
+    this->useRawHidCheckBox->hide();
+    this->measureHidLatencyCheckBox->hide();
+#endif // HIDAPI
+
     if (!CoreIsEmulationRunning() && !CoreIsEmulationPaused())
     {
         this->hideEmulationInfoText();
@@ -72,6 +79,8 @@ void OptionsDialog::accept()
     this->settings.ControllerPak = this->controllerPakComboBox->currentIndex();
     this->settings.GameboyRom = this->gameboyRomLineEdit->text().toStdString();
     this->settings.GameboySave = this->gameboySaveLineEdit->text().toStdString();
+    this->settings.UseRawHid = this->useRawHidCheckBox->isChecked();
+    this->settings.MeasureHidLatency = this->measureHidLatencyCheckBox->isChecked();
     this->settings.RemoveDuplicateMappings = this->removeDuplicateMappingsCheckbox->isChecked();
     this->settings.FilterEventsForButtons = this->filterEventsForButtonsCheckBox->isChecked();
     this->settings.FilterEventsForAxis = this->filterEventsForAxisCheckBox->isChecked();
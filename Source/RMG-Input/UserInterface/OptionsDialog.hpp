@@ -21,6 +21,8 @@ struct OptionsDialogSettings
     int     ControllerPak = 0;
     std::string GameboyRom;
     std::string GameboySave;
+    bool UseRawHid         = false;
+    bool MeasureHidLatency = false;
 
     // UI settings
     bool RemoveDuplicateMappings = false;
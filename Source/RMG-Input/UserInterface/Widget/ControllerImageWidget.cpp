@@ -110,60 +110,144 @@ void ControllerImageWidget::UpdateImage()
 }
 
 
-void ControllerImageWidget::paintEvent(QPaintEvent *event)
+QPixmap ControllerImageWidget::renderImage(const QString& imageUri, QRectF* viewBox)
+{
+    const qreal devicePixelRatio = this->devicePixelRatioF();
+
+    QSvgRenderer renderer(imageUri);
+    renderer.setAspectRatioMode(Qt::AspectRatioMode::KeepAspectRatio);
+
+    QPixmap pixmap(this->size() * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    renderer.render(&painter, QRectF(QPointF(0, 0), this->size()));
+
+    if (viewBox != nullptr)
+    {
+        *viewBox = renderer.viewBoxF();
+    }
+
+    return pixmap;
+}
+
+QPixmap ControllerImageWidget::renderElementImage(const QString& imageUri, const QString& elementId, QPoint& offset)
+{
+    const qreal devicePixelRatio = this->devicePixelRatioF();
+
+    QSvgRenderer renderer(imageUri);
+
+    // bounds of the element in the view box
+    const QRectF viewBox = renderer.viewBoxF();
+    const QRectF elementBounds = renderer.transformForElement(elementId).mapRect(renderer.boundsOnElement(elementId));
+    if (viewBox.isEmpty() || elementBounds.isEmpty())
+    {
+        return QPixmap();
+    }
+
+    // the whole image is scaled to fit the widget and
+    // centered in it, so map the element bounds the same way
+    const double scale = std::min(this->width() / viewBox.width(),
+                                  this->height() / viewBox.height());
+    const QPointF origin((this->width() - (viewBox.width() * scale)) / 2,
+                         (this->height() - (viewBox.height() * scale)) / 2);
+    const QRectF elementRect(origin + ((elementBounds.topLeft() - viewBox.topLeft()) * scale),
+                             elementBounds.size() * scale);
+
+    // only rasterize the pixels covered by the element,
+    // painting draws the pixmap at its offset
+    const QRect pixmapRect = elementRect.toAlignedRect();
+    offset = pixmapRect.topLeft();
+
+    QPixmap pixmap(pixmapRect.size() * devicePixelRatio);
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    renderer.render(&painter, elementId, elementRect.translated(-offset));
+
+    return pixmap;
+}
+
+void ControllerImageWidget::renderImages(void)
 {
-    QPainter painter(this);
-    QSvgRenderer renderer;
- 
     static const struct
     {
         enum N64ControllerButton button;
         QString imageUri;
+        QString elementId;
     } buttons[] =
     {
-        { N64ControllerButton::A, ":Resource/Controller_Pressed_A.svg" },
-        { N64ControllerButton::B, ":Resource/Controller_Pressed_B.svg" },
-        { N64ControllerButton::Start, ":Resource/Controller_Pressed_Start.svg" },
-        { N64ControllerButton::DpadUp, ":Resource/Controller_Pressed_DpadUp.svg" },
-        { N64ControllerButton::DpadDown, ":Resource/Controller_Pressed_DpadDown.svg" },
-        { N64ControllerButton::DpadLeft, ":Resource/Controller_Pressed_DpadLeft.svg" },
-        { N64ControllerButton::DpadRight, ":Resource/Controller_Pressed_DpadRight.svg" },
-        { N64ControllerButton::CButtonUp, ":Resource/Controller_Pressed_CButtonUp.svg" },
-        { N64ControllerButton::CButtonDown, ":Resource/Controller_Pressed_CButtonDown.svg" },
-        { N64ControllerButton::CButtonLeft, ":Resource/Controller_Pressed_CButtonLeft.svg" },
-        { N64ControllerButton::CButtonRight, ":Resource/Controller_Pressed_CButtonRight.svg" },
-        { N64ControllerButton::LeftTrigger, ":Resource/Controller_Pressed_LeftTrigger.svg" },
-        { N64ControllerButton::RightTrigger, ":Resource/Controller_Pressed_RightTrigger.svg" },
-        { N64ControllerButton::ZTrigger, ":Resource/Controller_Pressed_ZTrigger.svg" }
+        { N64ControllerButton::A, ":Resource/Controller_Pressed_A.svg", "path42" },
+        { N64ControllerButton::B, ":Resource/Controller_Pressed_B.svg", "path42" },
+        { N64ControllerButton::Start, ":Resource/Controller_Pressed_Start.svg", "path42" },
+        { N64ControllerButton::DpadUp, ":Resource/Controller_Pressed_DpadUp.svg", "path42" },
+        { N64ControllerButton::DpadDown, ":Resource/Controller_Pressed_DpadDown.svg", "path42" },
+        { N64ControllerButton::DpadLeft, ":Resource/Controller_Pressed_DpadLeft.svg", "path42" },
+        { N64ControllerButton::DpadRight, ":Resource/Controller_Pressed_DpadRight.svg", "path42" },
+        { N64ControllerButton::CButtonUp, ":Resource/Controller_Pressed_CButtonUp.svg", "path42" },
+        { N64ControllerButton::CButtonDown, ":Resource/Controller_Pressed_CButtonDown.svg", "path42" },
+        { N64ControllerButton::CButtonLeft, ":Resource/Controller_Pressed_CButtonLeft.svg", "path42" },
+        { N64ControllerButton::CButtonRight, ":Resource/Controller_Pressed_CButtonRight.svg", "path42" },
+        { N64ControllerButton::LeftTrigger, ":Resource/Controller_Pressed_LeftTrigger.svg", "path42-6" },
+        { N64ControllerButton::RightTrigger, ":Resource/Controller_Pressed_RightTrigger.svg", "path42" },
+        { N64ControllerButton::ZTrigger, ":Resource/Controller_Pressed_ZTrigger.svg", "g5916" }
     };
 
     static const QString baseImageUri = ":Resource/Controller_NoAnalogStick.svg";
     static const QString analogStickImageUri = ":Resource/Controller_AnalogStick.svg";
 
-    // render base image first
-    renderer.load(baseImageUri);
-    renderer.setAspectRatioMode(Qt::AspectRatioMode::KeepAspectRatio);
-    renderer.render(&painter);
+    this->baseImage = this->renderImage(baseImageUri);
 
-    // render button images on top
-    // when the button is pressed
     for (auto& button : buttons)
     {
-        if (this->buttonState[(int)button.button])
+        this->buttonImages[(int)button.button] = this->renderElementImage(button.imageUri, button.elementId,
+                                                                          this->buttonImageOffsets[(int)button.button]);
+    }
+
+    this->analogStickImage = this->renderImage(analogStickImageUri, &this->analogStickViewBox);
+
+    // scale from the view box of the
+    // analog stick image to the widget
+    if (!this->analogStickViewBox.isEmpty())
+    {
+        this->imageScale = std::min(this->width() / this->analogStickViewBox.width(),
+                                    this->height() / this->analogStickViewBox.height());
+    }
+
+    this->imageSize = this->size();
+    this->imageDevicePixelRatio = this->devicePixelRatioF();
+}
+
+void ControllerImageWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+
+    // render the images again when the size
+    // or the device pixel ratio has changed
+    if (this->imageSize != this->size() ||
+        this->imageDevicePixelRatio != this->devicePixelRatioF())
+    {
+        this->renderImages();
+    }
+
+    // draw base image first
+    painter.drawPixmap(0, 0, this->baseImage);
+
+    // draw button images on top
+    // when the button is pressed
+    for (int i = 0; i < (int)N64ControllerButton::Invalid; i++)
+    {
+        if (this->buttonState[i] && !this->buttonImages[i].isNull())
         {
-            renderer.load(button.imageUri);
-            renderer.setAspectRatioMode(Qt::AspectRatioMode::KeepAspectRatio);
-            renderer.render(&painter);
+            painter.drawPixmap(this->buttonImageOffsets[i], this->buttonImages[i]);
         }
     }
 
-    // render analog stick
-    renderer.load(analogStickImageUri);
-    renderer.setAspectRatioMode(Qt::AspectRatioMode::KeepAspectRatio);
-
-    QRectF rectF = renderer.viewBoxF();
-    const int width = rectF.width();
-    const int height = rectF.height();
+    // draw analog stick
+    const int width = this->analogStickViewBox.width();
+    const int height = this->analogStickViewBox.height();
     // we'll move the analog stick by a percentage
     // of the total width/height from the image
     const double absoluteMaxOffset = ((double)(height * 0.12265f) / 2);
@@ -193,24 +277,20 @@ void ControllerImageWidget::paintEvent(QPaintEvent *event)
         offsety = (offsety / offsetDist) * sensitivityAdjustedMaxOffset;
     }
 
-    // adjust rect with offset
-    rectF.adjust(
-        // dx1
-        offsetx,
-        // dy1
-        offsety,
-        // dx2
-        0,
-        // dy2
-        0
-    );
-
-    // make sure we keep the same 
-    // width and height
-    rectF.setWidth(width);
-    rectF.setHeight(height);
-
-    // set viewbox and render
-    renderer.setViewBox(rectF);
-    renderer.render(&painter);
+    // moving the view box by the offset moves
+    // the image the other way, so we translate
+    // the image by the scaled inverse offset,
+    // clipped to the area of the image
+    QRectF imageRect(0, 0, width * this->imageScale, height * this->imageScale);
+    imageRect.moveCenter(QRectF(this->rect()).center());
+    painter.setClipRect(imageRect);
+    painter.drawPixmap(QPointF(-offsetx * this->imageScale, -offsety * this->imageScale), this->analogStickImage);
+}
+
+void ControllerImageWidget::resizeEvent(QResizeEvent *event)
+{
+    // the images will be rendered again
+    // on the next paint event
+    this->imageSize = QSize();
+    QWidget::resizeEvent(event);
 }
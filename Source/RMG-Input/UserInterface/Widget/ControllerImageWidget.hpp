@@ -11,6 +11,7 @@
 #define CONTROLLERIMAGEWIDGET_HPP
 
 #include <QWidget>
+#include <QPixmap>
 
 #include "common.hpp"
 
@@ -35,6 +36,24 @@ private:
     int sensitivityValue = 100;
 
     bool needImageUpdate = false;
+
+    // the images are rendered once for
+    // the size and device pixel ratio of
+    // the widget, painting only draws them,
+    // the button images only cover their element
+    QPixmap baseImage;
+    QPixmap buttonImages[(int)N64ControllerButton::Invalid];
+    QPoint  buttonImageOffsets[(int)N64ControllerButton::Invalid];
+    QPixmap analogStickImage;
+    QRectF  analogStickViewBox;
+    double  imageScale = 1.0;
+    QSize   imageSize;
+    qreal   imageDevicePixelRatio = 0;
+
+    QPixmap renderImage(const QString& imageUri, QRectF* viewBox = nullptr);
+    QPixmap renderElementImage(const QString& imageUri, const QString& elementId, QPoint& offset);
+    void renderImages(void);
+
 public:
     ControllerImageWidget(QWidget* parent);
     ~ControllerImageWidget();
@@ -49,6 +68,7 @@ public:
     void UpdateImage();
 
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
 };
 }
 }
@@ -9,6 +9,7 @@
  */
 #include "ControllerWidget.hpp"
 #include "UserInterface/OptionsDialog.hpp"
+#include "Utilities/InputProfileBlob.hpp"
 
 #include "common.hpp"
 
@@ -341,6 +342,20 @@ bool ControllerWidget::isSectionGameProfile(QString section)
     return !this->isSectionUserProfile(section) && section.contains("Game");
 }
 
+void ControllerWidget::storeSectionHash(QString section)
+{
+    uint64_t hash;
+
+    // the hash tells RMG-Input whether the compiled
+    // blob of the section is still valid
+    Utilities::InputProfileBlob::StoreSectionHash(section.toStdString(), hash);
+
+    if (!this->savedSections.contains(section))
+    {
+        this->savedSections.append(section);
+    }
+}
+
 void ControllerWidget::setPluggedIn(bool value)
 {
     QWidget* widgetList[] =
@@ -1416,6 +1431,8 @@ void ControllerWidget::LoadSettings(QString sectionQString, bool loadUserProfile
     this->optionsDialogSettings.ControllerPak = CoreSettingsGetIntValue(SettingsID::Input_Pak, section);
     this->optionsDialogSettings.GameboyRom = CoreSettingsGetStringValue(SettingsID::Input_GameboyRom, section);
     this->optionsDialogSettings.GameboySave = CoreSettingsGetStringValue(SettingsID::Input_GameboySave, section);
+    this->optionsDialogSettings.UseRawHid = CoreSettingsGetBoolValue(SettingsID::Input_UseRawHid, section);
+    this->optionsDialogSettings.MeasureHidLatency = CoreSettingsGetBoolValue(SettingsID::Input_MeasureHidLatency, section);
 
     // keep backwards compatibility with old profiles
     if (CoreSettingsKeyExists(section, "FilterEventsForButtons") &&
@@ -1509,6 +1526,8 @@ void ControllerWidget::SaveDefaultSettings()
         CoreSettingsSetValue(buttonSetting.dataSettingsId, section, std::vector<int>({ 0 }));
         CoreSettingsSetValue(buttonSetting.extraDataSettingsId, section, std::vector<int>({ 0 }));
     }
+
+    this->storeSectionHash(this->settingsSection);
 }
 
 void ControllerWidget::SaveSettings()
@@ -1593,6 +1612,8 @@ void ControllerWidget::SaveSettings(QString section)
     CoreSettingsSetValue(SettingsID::Input_Pak, sectionStr, this->optionsDialogSettings.ControllerPak);
     CoreSettingsSetValue(SettingsID::Input_GameboyRom, sectionStr, this->optionsDialogSettings.GameboyRom);
     CoreSettingsSetValue(SettingsID::Input_GameboySave, sectionStr, this->optionsDialogSettings.GameboySave);
+    CoreSettingsSetValue(SettingsID::Input_UseRawHid, sectionStr, this->optionsDialogSettings.UseRawHid);
+    CoreSettingsSetValue(SettingsID::Input_MeasureHidLatency, sectionStr, this->optionsDialogSettings.MeasureHidLatency);
     CoreSettingsSetValue(SettingsID::Input_RemoveDuplicateMappings, sectionStr, this->optionsDialogSettings.RemoveDuplicateMappings);
     CoreSettingsSetValue(SettingsID::Input_FilterEventsForButtons, sectionStr, this->optionsDialogSettings.FilterEventsForButtons);
     CoreSettingsSetValue(SettingsID::Input_FilterEventsForAxis, sectionStr, this->optionsDialogSettings.FilterEventsForAxis);
@@ -1612,6 +1633,13 @@ void ControllerWidget::SaveSettings(QString section)
         CoreSettingsSetValue(hotkeySetting.dataSettingsId, sectionStr, hotkeySetting.inputData);
         CoreSettingsSetValue(hotkeySetting.extraDataSettingsId, sectionStr, hotkeySetting.extraInputData);
     }
+
+    this->storeSectionHash(section);
+}
+
+QList<QString> ControllerWidget::GetSavedSections()
+{
+    return this->savedSections;
 }
 
 void ControllerWidget::RevertSettings()
@@ -48,6 +48,9 @@ private:
     QList<QString> profiles;
     QList<QString> removedProfiles;
     QList<QString> addedProfiles;
+    // sections which have been saved,
+    // their blobs are compiled after saving
+    QList<QString> savedSections;
 
     struct buttonWidgetMapping
     {
@@ -97,6 +100,8 @@ private:
 
     void setPluggedIn(bool value);
 
+    void storeSectionHash(QString section);
+
     bool hasAnyGameSettingChanged(void);
 
     void showErrorMessage(QString text, QString details = "");
@@ -140,6 +145,8 @@ public:
 
     void RevertSettings();
 
+    QList<QString> GetSavedSections();
+
     void SetCurrentJoystickID(SDL_JoystickID joystickId);
     void SetIsCurrentJoystickGameController(bool isGameController);
 
@@ -0,0 +1,70 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "FrameTimeStatistics.hpp"
+
+#include <algorithm>
+
+using namespace Utilities;
+
+FrameTimeStatistics::FrameTimeStatistics(std::string name)
+{
+    this->name = name;
+}
+
+void FrameTimeStatistics::AddTime(std::chrono::nanoseconds time)
+{
+    this->frameTime += time.count();
+}
+
+void FrameTimeStatistics::EndFrame(void)
+{
+    uint64_t microseconds = this->frameTime / 1000;
+    int bucket = 0;
+
+    while (bucket < (FRAME_TIME_STATISTICS_BUCKETS - 1) &&
+           microseconds >= (1ULL << bucket))
+    {
+        bucket++;
+    }
+
+    this->buckets[bucket]++;
+    this->totalTime += this->frameTime;
+    this->maxTime = std::max(this->maxTime, this->frameTime);
+    this->frames++;
+    this->frameTime = 0;
+}
+
+void FrameTimeStatistics::Reset(void)
+{
+    this->frameTime = 0;
+    this->totalTime = 0;
+    this->maxTime   = 0;
+    this->frames    = 0;
+    std::fill(std::begin(this->buckets), std::end(this->buckets), 0);
+}
+
+std::string FrameTimeStatistics::GetSummary(void)
+{
+    std::string summary;
+    uint64_t averageTime = this->frames == 0 ? 0 : this->totalTime / this->frames;
+
+    summary = this->name;
+    summary += ": " + std::to_string(this->frames) + " frames";
+    summary += ", average " + std::to_string(averageTime) + "ns";
+    summary += ", max " + std::to_string(this->maxTime) + "ns";
+    summary += ", frames below 2^N us:";
+
+    for (int i = 0; i < FRAME_TIME_STATISTICS_BUCKETS; i++)
+    {
+        summary += " " + std::to_string(this->buckets[i]);
+    }
+
+    return summary;
+}
@@ -0,0 +1,55 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef FRAMETIMESTATISTICS_HPP
+#define FRAMETIMESTATISTICS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// amount of histogram buckets, bucket N counts
+// the frames which took less than 2^N microseconds,
+// the last bucket also counts all slower frames
+#define FRAME_TIME_STATISTICS_BUCKETS 12
+
+namespace Utilities
+{
+// accumulates the time spent in a function per frame,
+// isn't thread safe, so it should only be used
+// from a single thread
+class FrameTimeStatistics
+{
+public:
+    FrameTimeStatistics(std::string name);
+
+    // adds the time to the current frame
+    void AddTime(std::chrono::nanoseconds time);
+
+    // records the current frame and starts a new one
+    void EndFrame(void);
+
+    // removes all recorded frames
+    void Reset(void);
+
+    // returns a summary of the recorded frames
+    std::string GetSummary(void);
+
+private:
+    std::string name;
+
+    uint64_t frameTime = 0;
+    uint64_t totalTime = 0;
+    uint64_t maxTime   = 0;
+    uint64_t frames    = 0;
+    uint64_t buckets[FRAME_TIME_STATISTICS_BUCKETS] = {};
+};
+} // namespace Utilities
+
+#endif // FRAMETIMESTATISTICS_HPP
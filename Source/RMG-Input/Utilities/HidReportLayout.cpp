@@ -0,0 +1,424 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "HidReportLayout.hpp"
+
+#include <algorithm>
+
+using namespace Utilities;
+
+//
+// Local Defines
+//
+
+// item types
+#define HID_ITEM_TYPE_MAIN   0
+#define HID_ITEM_TYPE_GLOBAL 1
+#define HID_ITEM_TYPE_LOCAL  2
+
+// main item tags
+#define HID_MAIN_INPUT 0x8
+
+// global item tags
+#define HID_GLOBAL_USAGE_PAGE    0x0
+#define HID_GLOBAL_LOGICAL_MIN   0x1
+#define HID_GLOBAL_LOGICAL_MAX   0x2
+#define HID_GLOBAL_REPORT_SIZE   0x7
+#define HID_GLOBAL_REPORT_ID     0x8
+#define HID_GLOBAL_REPORT_COUNT  0x9
+#define HID_GLOBAL_PUSH          0xA
+#define HID_GLOBAL_POP           0xB
+
+// local item tags
+#define HID_LOCAL_USAGE     0x0
+#define HID_LOCAL_USAGE_MIN 0x1
+#define HID_LOCAL_USAGE_MAX 0x2
+
+// input item flags
+#define HID_INPUT_CONSTANT 0x1
+#define HID_INPUT_VARIABLE 0x2
+
+// usage pages
+#define HID_PAGE_GENERIC_DESKTOP 0x01
+#define HID_PAGE_BUTTON          0x09
+
+// generic desktop usages which SDL reports as axes,
+// X, Y, Z, Rx, Ry, Rz, Slider, Dial & Wheel
+#define HID_USAGE_AXIS_FIRST 0x30
+#define HID_USAGE_AXIS_LAST  0x38
+
+// fields larger than this aren't supported
+#define HID_MAX_FIELD_BITS 32
+
+//
+// Local Structures
+//
+
+struct hid_global_state
+{
+    uint32_t UsagePage      = 0;
+    int32_t  LogicalMinimum = 0;
+    int32_t  LogicalMaximum = 0;
+    uint32_t ReportSize     = 0;
+    uint32_t ReportCount    = 0;
+    uint8_t  ReportID       = 0;
+};
+
+//
+// Local Functions
+//
+
+static uint32_t read_unsigned(const uint8_t* data, int size)
+{
+    uint32_t value = 0;
+
+    for (int i = 0; i < size; i++)
+    {
+        value |= (uint32_t)data[i] << (i * 8);
+    }
+
+    return value;
+}
+
+static int32_t read_signed(const uint8_t* data, int size)
+{
+    uint32_t value = read_unsigned(data, size);
+
+    if (size > 0 && size < 4 && (value & (1U << (size * 8 - 1))))
+    {
+        value |= ~0U << (size * 8);
+    }
+
+    return (int32_t)value;
+}
+
+static uint32_t read_bits(const uint8_t* report, uint32_t bitOffset, int bitSize)
+{
+    uint64_t value = 0;
+    const uint32_t firstByte = bitOffset / 8;
+    const uint32_t lastByte  = (bitOffset + bitSize - 1) / 8;
+
+    for (uint32_t i = firstByte; i <= lastByte; i++)
+    {
+        value |= (uint64_t)report[i] << ((i - firstByte) * 8);
+    }
+
+    value >>= bitOffset % 8;
+    return (uint32_t)(value & ((1ULL << bitSize) - 1));
+}
+
+//
+// Exported Functions
+//
+
+bool HidReportLayout::Parse(const uint8_t* descriptor, size_t size)
+{
+    struct axis_field
+    {
+        uint32_t Usage;
+        Field    AxisField;
+    };
+
+    hid_global_state globalState;
+    std::vector<hid_global_state> globalStack;
+    std::vector<uint32_t> usages;
+    uint32_t usageMinimum = 0;
+    uint32_t usageMaximum = 0;
+    bool hasUsageRange = false;
+
+    std::vector<axis_field> axisFields;
+    std::vector<uint32_t> axisUsages;
+    uint32_t inputBitOffsets[256] = {0};
+
+    this->buttonFields.clear();
+    this->axisFields.clear();
+    this->usesReportIDs = false;
+    this->buttonCount = 0;
+    this->axisCount = 0;
+
+    size_t position = 0;
+    while (position < size)
+    {
+        const uint8_t prefix = descriptor[position];
+
+        // long items aren't used by any
+        // known device, so skip them
+        if (prefix == 0xFE)
+        {
+            if (position + 1 >= size)
+            {
+                break;
+            }
+            position += 3 + descriptor[position + 1];
+            continue;
+        }
+
+        const int dataSize = (prefix & 0x3) == 3 ? 4 : (prefix & 0x3);
+        const int type     = (prefix >> 2) & 0x3;
+        const int tag      = prefix >> 4;
+
+        if (position + 1 + dataSize > size)
+        {
+            break;
+        }
+
+        const uint8_t* data = descriptor + position + 1;
+        position += 1 + dataSize;
+
+        if (type == HID_ITEM_TYPE_GLOBAL)
+        {
+            switch (tag)
+            {
+            case HID_GLOBAL_USAGE_PAGE:
+                globalState.UsagePage = read_unsigned(data, dataSize);
+                break;
+            case HID_GLOBAL_LOGICAL_MIN:
+                globalState.LogicalMinimum = read_signed(data, dataSize);
+                break;
+            case HID_GLOBAL_LOGICAL_MAX:
+                globalState.LogicalMaximum = read_signed(data, dataSize);
+                // a lot of devices encode an unsigned maximum
+                // without the extra byte it needs, so use
+                // the unsigned value when it'd be below the minimum
+                if (globalState.LogicalMinimum >= 0 &&
+                    globalState.LogicalMaximum < globalState.LogicalMinimum)
+                {
+                    globalState.LogicalMaximum = (int32_t)read_unsigned(data, dataSize);
+                }
+                break;
+            case HID_GLOBAL_REPORT_SIZE:
+                globalState.ReportSize = read_unsigned(data, dataSize);
+                break;
+            case HID_GLOBAL_REPORT_ID:
+                globalState.ReportID = (uint8_t)read_unsigned(data, dataSize);
+                this->usesReportIDs = true;
+                break;
+            case HID_GLOBAL_REPORT_COUNT:
+                globalState.ReportCount = read_unsigned(data, dataSize);
+                break;
+            case HID_GLOBAL_PUSH:
+                globalStack.push_back(globalState);
+                break;
+            case HID_GLOBAL_POP:
+                if (!globalStack.empty())
+                {
+                    globalState = globalStack.back();
+                    globalStack.pop_back();
+                }
+                break;
+            default:
+                break;
+            }
+            continue;
+        }
+
+        if (type == HID_ITEM_TYPE_LOCAL)
+        {
+            // 4 byte usages contain their usage page
+            uint32_t usage = read_unsigned(data, dataSize);
+            if (dataSize < 4)
+            {
+                usage |= globalState.UsagePage << 16;
+            }
+
+            switch (tag)
+            {
+            case HID_LOCAL_USAGE:
+                usages.push_back(usage);
+                break;
+            case HID_LOCAL_USAGE_MIN:
+                usageMinimum = usage;
+                hasUsageRange = true;
+                break;
+            case HID_LOCAL_USAGE_MAX:
+                usageMaximum = usage;
+                hasUsageRange = true;
+                break;
+            default:
+                break;
+            }
+            continue;
+        }
+
+        if (type != HID_ITEM_TYPE_MAIN)
+        {
+            continue;
+        }
+
+        if (tag == HID_MAIN_INPUT)
+        {
+            const uint32_t flags = read_unsigned(data, dataSize);
+            uint32_t& bitOffset = inputBitOffsets[globalState.ReportID];
+
+            // constant fields are padding and array fields
+            // (keyboard style button lists) aren't supported,
+            // both only move the offset of the next field
+            if ((flags & HID_INPUT_CONSTANT) || !(flags & HID_INPUT_VARIABLE) ||
+                globalState.ReportSize == 0 || globalState.ReportSize > HID_MAX_FIELD_BITS)
+            {
+                bitOffset += globalState.ReportSize * globalState.ReportCount;
+            }
+            else
+            {
+                for (uint32_t i = 0; i < globalState.ReportCount; i++)
+                {
+                    uint32_t usage = 0;
+
+                    if (hasUsageRange)
+                    {
+                        usage = std::min(usageMinimum + i, usageMaximum);
+                    }
+                    else if (!usages.empty())
+                    {
+                        usage = usages[std::min<size_t>(i, usages.size() - 1)];
+                    }
+
+                    Field field;
+                    field.ReportID       = globalState.ReportID;
+                    field.Index          = 0;
+                    field.BitSize        = (uint8_t)globalState.ReportSize;
+                    field.Signed         = globalState.LogicalMinimum < 0;
+                    field.BitOffset      = bitOffset;
+                    field.LogicalMinimum = globalState.LogicalMinimum;
+                    field.LogicalMaximum = globalState.LogicalMaximum;
+
+                    const uint32_t usagePage = usage >> 16;
+                    const uint32_t usageID   = usage & 0xFFFF;
+
+                    // SDL's button indexes follow the button usages
+                    if (usagePage == HID_PAGE_BUTTON && usageID >= 1 && usageID <= 64)
+                    {
+                        field.Index = (uint8_t)(usageID - 1);
+                        this->buttonFields.push_back(field);
+                        this->buttonCount = std::max(this->buttonCount, (int)usageID);
+                    }
+                    else if (usagePage == HID_PAGE_GENERIC_DESKTOP &&
+                             usageID >= HID_USAGE_AXIS_FIRST && usageID <= HID_USAGE_AXIS_LAST)
+                    {
+                        axisFields.push_back({usageID, field});
+                        axisUsages.push_back(usageID);
+                    }
+
+                    bitOffset += globalState.ReportSize;
+                }
+            }
+        }
+
+        // local items only apply to the next main item
+        usages.clear();
+        hasUsageRange = false;
+    }
+
+    // SDL's axis indexes follow the order of the usages,
+    // i.e X is always before Y, even when a device
+    // puts them in a different order in its reports
+    std::sort(axisUsages.begin(), axisUsages.end());
+    axisUsages.erase(std::unique(axisUsages.begin(), axisUsages.end()), axisUsages.end());
+
+    for (axis_field& axisField : axisFields)
+    {
+        const int index = (int)(std::lower_bound(axisUsages.begin(), axisUsages.end(), axisField.Usage) - axisUsages.begin());
+        if (index >= INPUT_DEVICE_MAX_AXES)
+        {
+            continue;
+        }
+
+        axisField.AxisField.Index = (uint8_t)index;
+        this->axisFields.push_back(axisField.AxisField);
+    }
+
+    this->axisCount = std::min((int)axisUsages.size(), INPUT_DEVICE_MAX_AXES);
+
+    return !this->buttonFields.empty() || !this->axisFields.empty();
+}
+
+bool HidReportLayout::ReadReport(const uint8_t* report, size_t size, InputDeviceState& state) const
+{
+    uint8_t reportID = 0;
+    bool hasField = false;
+
+    // when the device uses report IDs,
+    // the first byte contains the report ID
+    if (this->usesReportIDs)
+    {
+        if (size == 0)
+        {
+            return false;
+        }
+
+        reportID = report[0];
+        report++;
+        size--;
+    }
+
+    const uint64_t reportBits = (uint64_t)size * 8;
+
+    for (const Field& field : this->buttonFields)
+    {
+        if (field.ReportID != reportID ||
+            field.BitOffset + field.BitSize > reportBits)
+        {
+            continue;
+        }
+
+        const uint64_t mask = 1ULL << field.Index;
+        if (read_bits(report, field.BitOffset, field.BitSize) != 0)
+        {
+            state.JoystickButtons |= mask;
+        }
+        else
+        {
+            state.JoystickButtons &= ~mask;
+        }
+
+        hasField = true;
+    }
+
+    for (const Field& field : this->axisFields)
+    {
+        if (field.ReportID != reportID ||
+            field.BitOffset + field.BitSize > reportBits)
+        {
+            continue;
+        }
+
+        int64_t value = read_bits(report, field.BitOffset, field.BitSize);
+        if (field.Signed && field.BitSize < 32 && (value & (1LL << (field.BitSize - 1))))
+        {
+            value -= 1LL << field.BitSize;
+        }
+        else if (field.Signed && field.BitSize == 32)
+        {
+            value = (int32_t)value;
+        }
+
+        // scale the logical range to the range of SDL axes
+        const int64_t minimum = field.LogicalMinimum;
+        const int64_t maximum = field.LogicalMaximum;
+        if (maximum > minimum)
+        {
+            value = std::clamp(value, minimum, maximum);
+            state.JoystickAxes[field.Index] = (int16_t)(((value - minimum) * 65535) / (maximum - minimum) - 32768);
+        }
+
+        hasField = true;
+    }
+
+    return hasField;
+}
+
+int HidReportLayout::GetButtonCount(void) const
+{
+    return this->buttonCount;
+}
+
+int HidReportLayout::GetAxisCount(void) const
+{
+    return this->axisCount;
+}
@@ -0,0 +1,62 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef HIDREPORTLAYOUT_HPP
+#define HIDREPORTLAYOUT_HPP
+
+#include "InputDeviceState.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Utilities
+{
+// layout of the input reports of a HID device,
+// parsed from its report descriptor, the buttons
+// and axes use the same indexes as SDL joysticks,
+// so mappings made with SDL can be used as-is
+class HidReportLayout
+{
+public:
+    // parses the report descriptor,
+    // returns false when it doesn't
+    // describe any buttons or axes
+    bool Parse(const uint8_t* descriptor, size_t size);
+
+    // updates the joystick buttons & axes of the state
+    // with the input report, returns false when the
+    // report isn't described by the layout
+    bool ReadReport(const uint8_t* report, size_t size, InputDeviceState& state) const;
+
+    int GetButtonCount(void) const;
+    int GetAxisCount(void) const;
+
+private:
+    struct Field
+    {
+        uint8_t  ReportID;
+        uint8_t  Index;
+        uint8_t  BitSize;
+        bool     Signed;
+        uint32_t BitOffset;
+        int32_t  LogicalMinimum;
+        int32_t  LogicalMaximum;
+    };
+
+    std::vector<Field> buttonFields;
+    std::vector<Field> axisFields;
+
+    bool usesReportIDs = false;
+    int  buttonCount   = 0;
+    int  axisCount     = 0;
+};
+} // namespace Utilities
+
+#endif // HIDREPORTLAYOUT_HPP
@@ -9,6 +9,14 @@
  */
 #include "InputDevice.hpp"
 
+#ifdef HIDAPI
+#include <RMG-Core/Core.hpp>
+
+#include <algorithm>
+#endif // HIDAPI
+#include <chrono>
+#include <cstring>
+
 using namespace Utilities;
 
 InputDevice::InputDevice()
@@ -24,10 +32,10 @@ InputDevice::~InputDevice()
 void InputDevice::SetSDLThread(Thread::SDLThread* sdlThread)
 {
     this->sdlThread = sdlThread;
-    connect(this->sdlThread, &Thread::SDLThread::OnInputDeviceFound, this,
-        &InputDevice::on_SDLThread_DeviceFound);
     connect(this->sdlThread, &Thread::SDLThread::OnDeviceSearchFinished, this,
         &InputDevice::on_SDLThread_DeviceSearchFinished);
+    connect(this->sdlThread, &Thread::SDLThread::OnInputDevicesChanged, this,
+        &InputDevice::on_SDLThread_InputDevicesChanged);
 }
 
 SDL_Joystick* InputDevice::GetJoystickHandle()
@@ -42,6 +50,8 @@ SDL_GameController* InputDevice::GetGameControllerHandle()
 
 bool InputDevice::StartRumble(void)
 {
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+
     if (this->gameController != nullptr)
     {
         return SDL_GameControllerRumble(this->gameController, 0xFFFF, 0xFFFF, SDL_HAPTIC_INFINITY) == 0;
@@ -56,6 +66,8 @@ bool InputDevice::StartRumble(void)
 
 bool InputDevice::StopRumble(void)
 {
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+
     if (this->gameController != nullptr)
     {
         return SDL_GameControllerRumble(this->gameController, 0, 0, 0) == 0;
@@ -70,6 +82,7 @@ bool InputDevice::StopRumble(void)
 
 bool InputDevice::IsAttached(void)
 {
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
     return SDL_JoystickGetAttached(this->joystick) == SDL_TRUE;
 }
 
@@ -78,6 +91,11 @@ bool InputDevice::HasOpenDevice()
     return this->hasOpenDevice;
 }
 
+void InputDevice::SetUseRawHid(bool useRawHid)
+{
+    this->useRawHid = useRawHid;
+}
+
 void InputDevice::OpenDevice(std::string name, int num)
 {
     // wait until SDLThread is done first
@@ -86,7 +104,6 @@ void InputDevice::OpenDevice(std::string name, int num)
         QThread::msleep(5);
     }
 
-    this->foundDevicesWithNameMatch.clear();
     this->desiredDeviceName = name;
     this->desiredDeviceNum = num;
     this->isOpeningDevice = true;
@@ -102,74 +119,292 @@ bool InputDevice::IsOpeningDevice(void)
 
 bool InputDevice::CloseDevice()
 {
-    if (this->joystick != nullptr)
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+    this->desiredDeviceName.clear();
+    this->closeDevice();
+    return true;
+}
+
+void InputDevice::UpdateState(void)
+{
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+#ifdef HIDAPI
+    // HidThread publishes the state itself
+    if (this->hidThread != nullptr)
     {
-        SDL_JoystickClose(this->joystick);
-        this->joystick = nullptr;
+        return;
     }
+#endif // HIDAPI
+    this->publishState(ReadInputDeviceState(this->joystick, this->gameController));
+}
 
-    if (this->gameController != nullptr)
+InputDeviceState InputDevice::GetState(void)
+{
+    uint64_t words[stateWordCount];
+    uint32_t sequence;
+
+    do
     {
-        SDL_GameControllerClose(this->gameController);
-        this->gameController = nullptr;
+        sequence = this->stateSequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < stateWordCount; i++)
+        {
+            words[i] = this->stateWords[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) || sequence != this->stateSequence.load(std::memory_order_relaxed));
+
+    InputDeviceState state;
+    memcpy(&state, words, sizeof(state));
+    return state;
+}
+
+void InputDevice::publishState(const InputDeviceState& state)
+{
+    uint64_t words[stateWordCount] = {};
+    InputDeviceState newState = state;
+
+    // keep track of when the input last changed,
+    // so the input latency can be measured
+    if (HasInputChanged(this->publishedState, newState))
+    {
+        newState.ChangeTimestamp = newState.Timestamp;
+        if (newState.ChangeTimestamp == 0)
+        {
+            newState.ChangeTimestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    }
+    else
+    {
+        newState.ChangeTimestamp = this->publishedState.ChangeTimestamp;
     }
+    this->publishedState = newState;
 
-    return true;
+    memcpy(words, &newState, sizeof(newState));
+
+    const uint32_t sequence = this->stateSequence.load(std::memory_order_relaxed);
+    this->stateSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < stateWordCount; i++)
+    {
+        this->stateWords[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    this->stateSequence.store(sequence + 2, std::memory_order_release);
 }
 
-void InputDevice::on_SDLThread_DeviceFound(QString name, int number)
+void InputDevice::openDevice(void)
 {
-    if ((!this->isOpeningDevice) || 
-        (this->desiredDeviceName != name.toStdString()))
+    std::vector<SDLDevice> devices = this->sdlThread->GetCachedInputDevices();
+    const SDLDevice* device = nullptr;
+
+    this->closeDevice();
+
+    // use the exact match when it exists,
+    // else prefer the device we've opened before,
+    // else use the first device with a name match
+    for (const SDLDevice& foundDevice : devices)
+    {
+        if (foundDevice.Name != this->desiredDeviceName)
+        {
+            continue;
+        }
+
+        if (foundDevice.Number == this->desiredDeviceNum)
+        {
+            device = &foundDevice;
+            break;
+        }
+
+        if (device == nullptr ||
+            (foundDevice.GUID == this->openedDeviceGUID && device->GUID != this->openedDeviceGUID))
+        {
+            device = &foundDevice;
+        }
+    }
+
+    if (device == nullptr)
     {
         return;
     }
 
-    SDLDevice device;
-    device.name = name.toStdString();
-    device.number = number;
+    this->joystick = SDL_JoystickOpen(device->Number);
+    if (SDL_IsGameController(device->Number))
+    {
+        this->gameController = SDL_GameControllerOpen(device->Number);
+    }
+
+    this->openedDeviceGUID = device->GUID;
+    this->hasOpenDevice = this->joystick != nullptr || this->gameController != nullptr;
 
-    this->foundDevicesWithNameMatch.push_back(device);
+#ifdef HIDAPI
+    if (this->useRawHid && this->hasOpenDevice)
+    {
+        this->openHidDevice(*device, devices);
+    }
+#endif // HIDAPI
 }
 
-void InputDevice::on_SDLThread_DeviceSearchFinished(void)
+#ifdef HIDAPI
+void InputDevice::openHidDevice(const SDLDevice& device, const std::vector<SDLDevice>& devices)
 {
-    if (!this->isOpeningDevice)
+    // HID reports are mapped to joystick buttons & axes,
+    // game controller mappings can't be supported that way
+    if (this->gameController != nullptr)
     {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning,
+            "RMG-Input: raw HID isn't supported for game controllers, using SDL for " + device.Name);
         return;
     }
 
-    this->CloseDevice();
+    const uint16_t vendorId  = SDL_JoystickGetDeviceVendor(device.Number);
+    const uint16_t productId = SDL_JoystickGetDeviceProduct(device.Number);
+    if (vendorId == 0 && productId == 0)
+    {
+        return;
+    }
+
+    // when multiple identical devices are connected,
+    // assume SDL and hidapi enumerate them in the same order
+    int deviceIndex = 0;
+    for (const SDLDevice& otherDevice : devices)
+    {
+        if (otherDevice.Number < device.Number &&
+            SDL_JoystickGetDeviceVendor(otherDevice.Number) == vendorId &&
+            SDL_JoystickGetDeviceProduct(otherDevice.Number) == productId)
+        {
+            deviceIndex++;
+        }
+    }
+
+    // only use joystick & gamepad interfaces,
+    // adapters can expose other interfaces too
+    std::vector<std::string> paths;
+    hid_device_info* deviceInfos = hid_enumerate(vendorId, productId);
+    for (hid_device_info* deviceInfo = deviceInfos; deviceInfo != nullptr; deviceInfo = deviceInfo->next)
+    {
+        if (deviceInfo->usage_page == 0x01 && (deviceInfo->usage == 0x04 || deviceInfo->usage == 0x05))
+        {
+            paths.push_back(deviceInfo->path);
+        }
+    }
+    hid_free_enumeration(deviceInfos);
 
-    if (this->foundDevicesWithNameMatch.empty())
+    std::sort(paths.begin(), paths.end());
+    if (deviceIndex >= (int)paths.size())
     {
-        this->isOpeningDevice = false;
-        this->hasOpenDevice = false;
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning,
+            "RMG-Input: failed to find HID device, using SDL for " + device.Name);
         return;
     }
 
-    // try to find exact match
-    SDLDevice device;
-    device.name = this->desiredDeviceName;
-    device.number = this->desiredDeviceNum;
+    hid_device* hidDevice = hid_open_path(paths.at(deviceIndex).c_str());
+    if (hidDevice == nullptr)
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning,
+            "RMG-Input: failed to open HID device, using SDL for " + device.Name);
+        return;
+    }
+
+    unsigned char descriptor[HID_API_MAX_REPORT_DESCRIPTOR_SIZE];
+    int descriptorSize = hid_get_report_descriptor(hidDevice, descriptor, sizeof(descriptor));
 
-    auto iter = std::find(this->foundDevicesWithNameMatch.begin(), this->foundDevicesWithNameMatch.end(), device);
-    if (iter != this->foundDevicesWithNameMatch.end())
-    { // use exact match
-        device.name = iter->name;
-        device.number = iter->number;
+    HidReportLayout layout;
+    if (descriptorSize <= 0 || !layout.Parse(descriptor, (size_t)descriptorSize))
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning,
+            "RMG-Input: unsupported HID report descriptor, using SDL for " + device.Name);
+        hid_close(hidDevice);
+        return;
     }
-    else
-    { // no exact match, use first with name match
-        device = this->foundDevicesWithNameMatch.at(0);
+
+    CoreDebugCallbackMessage(CoreDebugMessageType::Info,
+        "RMG-Input: reading " + device.Name + " through HID (" +
+        std::to_string(layout.GetButtonCount()) + " buttons, " +
+        std::to_string(layout.GetAxisCount()) + " axes)");
+
+    this->hidDevice = hidDevice;
+    this->hidThread = new Thread::HidThread(hidDevice, layout, [this](const InputDeviceState& state)
+    {
+        this->publishState(state);
+    }, nullptr);
+    this->hidThread->start();
+}
+#endif // HIDAPI
+
+void InputDevice::closeDevice(void)
+{
+#ifdef HIDAPI
+    // HidThread doesn't lock deviceMutex,
+    // so it's safe to wait for it here
+    if (this->hidThread != nullptr)
+    {
+        this->hidThread->StopLoop();
+        delete this->hidThread;
+        this->hidThread = nullptr;
+    }
+
+    if (this->hidDevice != nullptr)
+    {
+        hid_close(this->hidDevice);
+        this->hidDevice = nullptr;
+    }
+#endif // HIDAPI
+
+    if (this->joystick != nullptr)
+    {
+        SDL_JoystickClose(this->joystick);
+        this->joystick = nullptr;
+    }
+
+    if (this->gameController != nullptr)
+    {
+        SDL_GameControllerClose(this->gameController);
+        this->gameController = nullptr;
     }
 
-    this->joystick = SDL_JoystickOpen(device.number);
-    if (SDL_IsGameController(device.number))
+    this->hasOpenDevice = false;
+
+    // make sure no stale input remains
+    this->publishState(InputDeviceState());
+}
+
+void InputDevice::on_SDLThread_DeviceSearchFinished(void)
+{
+    if (!this->isOpeningDevice)
     {
-        this->gameController = SDL_GameControllerOpen(device.number);
+        return;
     }
 
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+
+    this->openDevice();
     this->isOpeningDevice = false;
-    this->hasOpenDevice = this->joystick != nullptr || this->gameController == nullptr;
+}
+
+void InputDevice::on_SDLThread_InputDevicesChanged(void)
+{
+    // we only have to re-open the device
+    // when we've been asked to open one
+    if (this->desiredDeviceName.empty() || this->isOpeningDevice)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->deviceMutex);
+
+    // nothing to do when the device is still attached
+    if (this->joystick != nullptr && SDL_JoystickGetAttached(this->joystick) == SDL_TRUE)
+    {
+        return;
+    }
+
+    this->openDevice();
 }
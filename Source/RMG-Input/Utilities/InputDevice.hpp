@@ -14,9 +14,15 @@
 
 #include <QObject>
 #include <string>
+#include <atomic>
+#include <mutex>
 #include <SDL.h>
 
 #include "Thread/SDLThread.hpp"
+#ifdef HIDAPI
+#include "Thread/HidThread.hpp"
+#endif // HIDAPI
+#include "InputDeviceState.hpp"
 
 namespace Utilities
 {
@@ -41,28 +47,31 @@ public:
     // returns whether a device has been opened
     bool HasOpenDevice(void);
 
+    // sets whether the device should be read
+    // through HID directly instead of through SDL,
+    // applies to the next device which is opened
+    void SetUseRawHid(bool useRawHid);
+
     // tries to open device with given name & num
     void OpenDevice(std::string name, int num);
 
     // returns whether we're still trying to open the device
     bool IsOpeningDevice(void);
 
-    // tries to close opened device
+    // tries to close opened device,
+    // the device won't be re-opened after
+    // a hot-plug event anymore
     bool CloseDevice(void);
 
-private:
-    struct SDLDevice
-    {
-        std::string name;
-        int number;
-
-        bool operator== (SDLDevice other)
-        {
-            return other.name == name &&
-                other.number == number;
-        }
-    };
+    // reads the current state of the device
+    // and publishes it as snapshot
+    void UpdateState(void);
 
+    // returns the last published snapshot,
+    // doesn't lock and can be called from any thread
+    InputDeviceState GetState(void);
+
+private:
     SDL_Joystick*       joystick = nullptr;
     SDL_GameController* gameController = nullptr;
 
@@ -74,11 +83,42 @@ private:
     std::string desiredDeviceName;
     int desiredDeviceNum;
 
-    std::vector<SDLDevice> foundDevicesWithNameMatch;
+    // GUID of the last opened device,
+    // used to find it again after a reconnect
+    std::string openedDeviceGUID;
+
+    bool useRawHid = false;
+#ifdef HIDAPI
+    hid_device* hidDevice = nullptr;
+    Thread::HidThread* hidThread = nullptr;
+#endif // HIDAPI
+
+    // guards the SDL & HID handles
+    std::mutex deviceMutex;
+
+    // snapshot published with a sequence lock,
+    // the sequence is odd while it's being written,
+    // writers are serialized by deviceMutex,
+    // except for HidThread, which is the only
+    // writer while it's running
+    static constexpr size_t stateWordCount = (sizeof(InputDeviceState) + 7) / 8;
+    alignas(64) std::atomic<uint32_t> stateSequence = {0};
+    std::atomic<uint64_t> stateWords[stateWordCount] = {};
+    // last published snapshot, only used
+    // by the writer to detect input changes
+    InputDeviceState publishedState;
+
+    // these expect deviceMutex to be locked
+    void openDevice(void);
+#ifdef HIDAPI
+    void openHidDevice(const SDLDevice& device, const std::vector<SDLDevice>& devices);
+#endif // HIDAPI
+    void closeDevice(void);
+    void publishState(const InputDeviceState& state);
 
 private slots:
-    void on_SDLThread_DeviceFound(QString, int);
     void on_SDLThread_DeviceSearchFinished(void);
+    void on_SDLThread_InputDevicesChanged(void);
 };
 } // namespace Utilities
 
@@ -0,0 +1,101 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "InputDeviceState.hpp"
+#include "common.hpp"
+
+#include <algorithm>
+
+using namespace Utilities;
+
+//
+// Local Functions
+//
+
+static int get_axis_direction(int16_t value)
+{
+    if (value >= (SDL_AXIS_PEAK / 2))
+    {
+        return 1;
+    }
+    else if (value <= -(SDL_AXIS_PEAK / 2))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+//
+// Exported Functions
+//
+
+bool Utilities::HasInputChanged(const InputDeviceState& oldState, const InputDeviceState& newState)
+{
+    if (oldState.GamepadButtons != newState.GamepadButtons ||
+        oldState.JoystickButtons != newState.JoystickButtons)
+    {
+        return true;
+    }
+
+    for (int i = 0; i < SDL_CONTROLLER_AXIS_MAX; i++)
+    {
+        if (get_axis_direction(oldState.GamepadAxes[i]) != get_axis_direction(newState.GamepadAxes[i]))
+        {
+            return true;
+        }
+    }
+
+    for (int i = 0; i < INPUT_DEVICE_MAX_AXES; i++)
+    {
+        if (get_axis_direction(oldState.JoystickAxes[i]) != get_axis_direction(newState.JoystickAxes[i]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+InputDeviceState Utilities::ReadInputDeviceState(SDL_Joystick* joystick, SDL_GameController* gameController)
+{
+    InputDeviceState state;
+
+    if (joystick != nullptr)
+    {
+        state.Attached = SDL_JoystickGetAttached(joystick) == SDL_TRUE;
+
+        const int buttons = std::min(SDL_JoystickNumButtons(joystick), 64);
+        for (int i = 0; i < buttons; i++)
+        {
+            state.JoystickButtons |= (uint64_t)(SDL_JoystickGetButton(joystick, i) ? 1 : 0) << i;
+        }
+
+        const int axes = std::min(SDL_JoystickNumAxes(joystick), INPUT_DEVICE_MAX_AXES);
+        for (int i = 0; i < axes; i++)
+        {
+            state.JoystickAxes[i] = SDL_JoystickGetAxis(joystick, i);
+        }
+    }
+
+    if (gameController != nullptr)
+    {
+        for (int i = 0; i < SDL_CONTROLLER_BUTTON_MAX; i++)
+        {
+            state.GamepadButtons |= (uint32_t)(SDL_GameControllerGetButton(gameController, (SDL_GameControllerButton)i) ? 1 : 0) << i;
+        }
+
+        for (int i = 0; i < SDL_CONTROLLER_AXIS_MAX; i++)
+        {
+            state.GamepadAxes[i] = SDL_GameControllerGetAxis(gameController, (SDL_GameControllerAxis)i);
+        }
+    }
+
+    return state;
+}
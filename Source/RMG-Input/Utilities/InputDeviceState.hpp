@@ -0,0 +1,69 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef INPUTDEVICESTATE_HPP
+#define INPUTDEVICESTATE_HPP
+
+#include <cstdint>
+#include <SDL.h>
+
+// maximum amount of joystick axes in a snapshot
+#define INPUT_DEVICE_MAX_AXES 16
+
+namespace Utilities
+{
+// snapshot of the state of an input device,
+// the getters return 0 for out of range indexes
+struct InputDeviceState
+{
+    bool     Attached = false;
+    uint32_t GamepadButtons = 0;
+    uint64_t JoystickButtons = 0;
+    int16_t  GamepadAxes[SDL_CONTROLLER_AXIS_MAX] = {};
+    int16_t  JoystickAxes[INPUT_DEVICE_MAX_AXES] = {};
+    // steady clock time in nanoseconds at which the
+    // source of the snapshot was read, 0 when unknown
+    uint64_t Timestamp = 0;
+    // steady clock time in nanoseconds at which a button
+    // was pressed or released or an axis crossed the
+    // half-way point, 0 when unknown
+    uint64_t ChangeTimestamp = 0;
+
+    int GetGamepadButton(int button) const
+    {
+        return (button >= 0 && button < 32) ? (this->GamepadButtons >> button) & 1 : 0;
+    }
+
+    int GetJoystickButton(int button) const
+    {
+        return (button >= 0 && button < 64) ? (this->JoystickButtons >> button) & 1 : 0;
+    }
+
+    int GetGamepadAxis(int axis) const
+    {
+        return (axis >= 0 && axis < SDL_CONTROLLER_AXIS_MAX) ? this->GamepadAxes[axis] : 0;
+    }
+
+    int GetJoystickAxis(int axis) const
+    {
+        return (axis >= 0 && axis < INPUT_DEVICE_MAX_AXES) ? this->JoystickAxes[axis] : 0;
+    }
+};
+
+// returns whether the buttons or the axis directions
+// differ, axes only count as pressed when they're
+// past the half-way point, like in the mapping table
+bool HasInputChanged(const InputDeviceState& oldState, const InputDeviceState& newState);
+
+// reads the state of the given SDL handles,
+// both handles may be nullptr
+InputDeviceState ReadInputDeviceState(SDL_Joystick* joystick, SDL_GameController* gameController);
+} // namespace Utilities
+
+#endif // INPUTDEVICESTATE_HPP
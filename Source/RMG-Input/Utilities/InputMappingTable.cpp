@@ -0,0 +1,429 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "InputMappingTable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace Utilities;
+
+//
+// Local Defines
+//
+
+#define N64_AXIS_PEAK      85
+#define MAX_DIAGONAL_VALUE 69
+
+// radius of the analog stick circle in
+// SDL axis units scaled by the sensitivity
+#define STICK_RADIUS ((int64_t)SDL_AXIS_PEAK * 100)
+
+enum class EntrySource : uint8_t
+{
+    GamepadButton,
+    GamepadAxis,
+    JoystickButton,
+    JoystickAxis,
+    Keyboard
+};
+
+// bit of each N64ControllerButton in the BUTTONS union
+static const uint8_t l_ButtonBits[] =
+{
+    7,  // A
+    6,  // B
+    4,  // Start
+    3,  // DpadUp
+    2,  // DpadDown
+    1,  // DpadLeft
+    0,  // DpadRight
+    11, // CButtonUp
+    10, // CButtonDown
+    9,  // CButtonLeft
+    8,  // CButtonRight
+    13, // LeftTrigger
+    12, // RightTrigger
+    5,  // ZTrigger
+};
+
+//
+// Local Functions
+//
+
+static inline int32_t read_source(uint8_t source, int index, const InputDeviceState& deviceState, const bool* keyboardState)
+{
+    switch ((EntrySource)source)
+    {
+        case EntrySource::GamepadButton:
+            return deviceState.GetGamepadButton(index);
+        case EntrySource::GamepadAxis:
+            return deviceState.GetGamepadAxis(index);
+        case EntrySource::JoystickButton:
+            return deviceState.GetJoystickButton(index);
+        case EntrySource::JoystickAxis:
+            return deviceState.GetJoystickAxis(index);
+        case EntrySource::Keyboard:
+            return keyboardState[index] ? 1 : 0;
+    }
+
+    return 0;
+}
+
+static inline bool is_axis_source(uint8_t source)
+{
+    return (EntrySource)source == EntrySource::GamepadAxis ||
+            (EntrySource)source == EntrySource::JoystickAxis;
+}
+
+// integer square root, the values we use
+// are small enough to be exact as double
+static uint64_t isqrt(uint64_t value)
+{
+    uint64_t result = (uint64_t)std::sqrt((double)value);
+
+    // correct rounding of the double result
+    while (result * result > value)
+    {
+        result--;
+    }
+    while ((result + 1) * (result + 1) <= value)
+    {
+        result++;
+    }
+
+    return result;
+}
+
+//
+// Exported Functions
+//
+
+void InputMappingTable::Clear(void)
+{
+    this->buttonEntryCount = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        this->axisEntryCount[i] = 0;
+    }
+
+    this->hotkeyInputCount = 0;
+    this->hotkeyCount = 0;
+    std::fill(std::begin(this->hotkeyMasks), std::end(this->hotkeyMasks), 0);
+}
+
+bool InputMappingTable::AddButtonMapping(N64ControllerButton button, const std::vector<int>& types,
+    const std::vector<int>& data, const std::vector<int>& extraData, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (this->buttonEntryCount == INPUT_MAPPING_TABLE_MAX_BUTTON_ENTRIES)
+        {
+            return false;
+        }
+
+        Entry& entry = this->buttonEntries[this->buttonEntryCount];
+        if (this->compileEntry(entry, types.at(i), data.at(i), extraData.at(i)))
+        {
+            entry.Output = l_ButtonBits[(int)button];
+            this->buttonEntryCount++;
+        }
+    }
+
+    return true;
+}
+
+bool InputMappingTable::AddAxisMapping(InputAxisDirection direction, const std::vector<int>& types,
+    const std::vector<int>& data, const std::vector<int>& extraData, int count)
+{
+    const int directionIndex = (int)direction;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (this->axisEntryCount[directionIndex] == INPUT_MAPPING_TABLE_MAX_AXIS_ENTRIES)
+        {
+            return false;
+        }
+
+        Entry& entry = this->axisEntries[directionIndex][this->axisEntryCount[directionIndex]];
+        if (this->compileEntry(entry, types.at(i), data.at(i), extraData.at(i)))
+        {
+            entry.Output = directionIndex;
+            this->axisEntryCount[directionIndex]++;
+        }
+    }
+
+    return true;
+}
+
+bool InputMappingTable::AddHotkeyMapping(int hotkey, const std::vector<int>& types,
+    const std::vector<int>& data, const std::vector<int>& extraData, int count)
+{
+    uint64_t mask = 0;
+
+    if (hotkey < 0 || hotkey >= INPUT_MAPPING_TABLE_MAX_HOTKEYS)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        Entry entry;
+        if (!this->compileEntry(entry, types.at(i), data.at(i), extraData.at(i)))
+        {
+            continue;
+        }
+
+        // hotkeys often share inputs (i.e a modifier button),
+        // so only add inputs which we don't have yet
+        int input = 0;
+        while (input < this->hotkeyInputCount &&
+               (this->hotkeyInputs[input].Source != entry.Source ||
+                this->hotkeyInputs[input].Index != entry.Index ||
+                this->hotkeyInputs[input].Sign != entry.Sign ||
+                this->hotkeyInputs[input].Threshold != entry.Threshold))
+        {
+            input++;
+        }
+
+        if (input == INPUT_MAPPING_TABLE_MAX_HOTKEY_INPUTS)
+        {
+            // a partial combination shouldn't
+            // trigger the hotkey, so disable it
+            this->hotkeyMasks[hotkey] = 0;
+            return false;
+        }
+
+        if (input == this->hotkeyInputCount)
+        {
+            entry.Output = input;
+            this->hotkeyInputs[input] = entry;
+            this->hotkeyInputCount++;
+        }
+
+        mask |= 1ULL << input;
+    }
+
+    this->hotkeyMasks[hotkey] = mask;
+    this->hotkeyCount = std::max(this->hotkeyCount, hotkey + 1);
+    return true;
+}
+
+void InputMappingTable::SetAnalogStickResponse(int deadzone, int sensitivity)
+{
+    deadzone    = std::max(deadzone, 0);
+    sensitivity = std::max(sensitivity, 0);
+
+    // don't increase emulated range at higher than 100% sensitivity
+    const int32_t limitedSensitivity = std::min(sensitivity, 100);
+    const int64_t maxDiagonal = ((int64_t)MAX_DIAGONAL_VALUE << 16) * limitedSensitivity / 100;
+
+    this->sensitivity = sensitivity;
+    this->maxAxis     = ((int64_t)N64_AXIS_PEAK << 16) * limitedSensitivity / 100;
+    this->deadzone    = (int64_t)(deadzone * N64_AXIS_PEAK * sensitivity / 10000) << 16;
+    this->inputScale  = ((this->maxAxis * sensitivity) << 32) / (SDL_AXIS_PEAK * 100);
+
+    // when the deadzone covers the whole range,
+    // the analog stick is disabled
+    if (this->maxAxis > this->deadzone)
+    {
+        this->deadzoneScale = (this->maxAxis << 32) / (this->maxAxis - this->deadzone);
+    }
+    else
+    {
+        this->deadzoneScale = 0;
+    }
+
+    if (maxDiagonal > 0)
+    {
+        this->diagonalFactor = ((this->maxAxis - maxDiagonal) << 16) / maxDiagonal;
+    }
+    else
+    {
+        this->diagonalFactor = 0;
+    }
+}
+
+uint32_t InputMappingTable::Evaluate(const InputDeviceState& deviceState, const bool* keyboardState) const
+{
+    uint32_t buttons = 0;
+
+    for (int i = 0; i < this->buttonEntryCount; i++)
+    {
+        const Entry& entry = this->buttonEntries[i];
+        const int32_t value = read_source(entry.Source, entry.Index, deviceState, keyboardState);
+
+        buttons |= (uint32_t)(value * entry.Sign >= entry.Threshold) << entry.Output;
+    }
+
+    // the directions are evaluated in order,
+    // when a button has been mapped to a direction,
+    // we should prioritize the button when it's been pressed
+    static const int directionAxis[4] = { 1, 1, 0, 0 };
+    static const int directionSign[4] = { 1, -1, -1, 1 };
+    int32_t stick[2] = { 0, 0 };
+    bool useButtonMapping = false;
+
+    for (int direction = 0; direction < 4; direction++)
+    {
+        const int axis = directionAxis[direction];
+        int32_t axisState = stick[axis];
+        int32_t buttonState = 0;
+
+        for (int i = 0; i < this->axisEntryCount[direction]; i++)
+        {
+            const Entry& entry = this->axisEntries[direction][i];
+            const int32_t value = read_source(entry.Source, entry.Index, deviceState, keyboardState);
+
+            if (is_axis_source(entry.Source))
+            {
+                if (value * entry.Sign > 0)
+                {
+                    axisState = std::abs(value) * directionSign[direction];
+                }
+            }
+            else
+            {
+                buttonState |= value;
+            }
+        }
+
+        if (buttonState)
+        {
+            useButtonMapping = true;
+            stick[axis] = SDL_AXIS_PEAK * directionSign[direction];
+        }
+        else if (!useButtonMapping)
+        {
+            stick[axis] = axisState;
+        }
+    }
+
+    int outputX = 0, outputY = 0;
+    this->simulateOctagon(stick[0], stick[1], outputX, outputY);
+
+    return buttons | ((uint32_t)(uint8_t)outputX << 16) | ((uint32_t)(uint8_t)outputY << 24);
+}
+
+uint64_t InputMappingTable::EvaluateHotkeys(const InputDeviceState& deviceState, const bool* keyboardState) const
+{
+    uint64_t inputs = 0;
+    uint64_t hotkeys = 0;
+
+    for (int i = 0; i < this->hotkeyInputCount; i++)
+    {
+        const Entry& entry = this->hotkeyInputs[i];
+        const int32_t value = read_source(entry.Source, entry.Index, deviceState, keyboardState);
+
+        inputs |= (uint64_t)(value * entry.Sign >= entry.Threshold) << i;
+    }
+
+    for (int i = 0; i < this->hotkeyCount; i++)
+    {
+        const uint64_t mask = this->hotkeyMasks[i];
+
+        hotkeys |= (uint64_t)(mask != 0 && (inputs & mask) == mask) << i;
+    }
+
+    return hotkeys;
+}
+
+bool InputMappingTable::compileEntry(Entry& entry, int type, int data, int extraData)
+{
+    if (data < 0 || data > UINT16_MAX)
+    {
+        return false;
+    }
+
+    entry.Index     = data;
+    entry.Sign      = 1;
+    entry.Threshold = 1;
+
+    switch ((InputType)type)
+    {
+        case InputType::GamepadButton:
+            entry.Source = (uint8_t)EntrySource::GamepadButton;
+            break;
+        case InputType::GamepadAxis:
+            entry.Source    = (uint8_t)EntrySource::GamepadAxis;
+            entry.Sign      = extraData ? 1 : -1;
+            entry.Threshold = SDL_AXIS_PEAK / 2;
+            break;
+        case InputType::JoystickButton:
+            entry.Source = (uint8_t)EntrySource::JoystickButton;
+            break;
+        case InputType::JoystickAxis:
+            entry.Source    = (uint8_t)EntrySource::JoystickAxis;
+            entry.Sign      = extraData ? 1 : -1;
+            entry.Threshold = SDL_AXIS_PEAK / 2;
+            break;
+        case InputType::Keyboard:
+            if (data >= SDL_NUM_SCANCODES)
+            {
+                return false;
+            }
+            entry.Source = (uint8_t)EntrySource::Keyboard;
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+// Credit: MerryMage & fzurita
+void InputMappingTable::simulateOctagon(int32_t inputX, int32_t inputY, int& outputX, int& outputY) const
+{
+    if (this->maxAxis == 0)
+    {
+        outputX = 0;
+        outputY = 0;
+        return;
+    }
+
+    // scale to [0, maxAxis]
+    int64_t ax = std::min<int64_t>((std::abs(inputX) * this->inputScale) >> 32, this->maxAxis);
+    int64_t ay = std::min<int64_t>((std::abs(inputY) * this->inputScale) >> 32, this->maxAxis);
+
+    // check whether (ax, ay) is within the circle of radius maxAxis,
+    // this is done on the unscaled input so it's exact, the deadzone
+    // is only applied inside of the circle, so deciding this on the
+    // truncated values changed the output by up to the deadzone
+    const int64_t sx = std::min<int64_t>(std::abs(inputX) * this->sensitivity, STICK_RADIUS);
+    const int64_t sy = std::min<int64_t>(std::abs(inputY) * this->sensitivity, STICK_RADIUS);
+    if (sx * sx + sy * sy <= STICK_RADIUS * STICK_RADIUS)
+    {
+        // create linear scaling from 0 at inner deadzone to maxAxis at outer limit
+        ax = ax > this->deadzone ? ((ax - this->deadzone) * this->deadzoneScale) >> 32 : 0;
+        ay = ay > this->deadzone ? ((ay - this->deadzone) * this->deadzoneScale) >> 32 : 0;
+    }
+    else
+    {
+        // scale ax and ay to stay on the same line, but at the edge of the circle
+        const int64_t scale = (this->maxAxis << 32) / isqrt(ax * ax + ay * ay);
+        ax = (ax * scale) >> 32;
+        ay = (ay * scale) >> 32;
+    }
+
+    // bound diagonals to an octagonal range [-69, 69],
+    // this is the edge of the octagon along the line through (ax, ay)
+    if (ax != 0 && ay != 0)
+    {
+        const int64_t edge = std::max(ay + ((ax * this->diagonalFactor) >> 16),
+                                      ax + ((ay * this->diagonalFactor) >> 16));
+        const int64_t scale = (isqrt(ax * ax + ay * ay) << 32) / edge;
+        ax = (ax * scale) >> 32;
+        ay = (ay * scale) >> 32;
+    }
+
+    outputX = (int)(ax >> 16) * (inputX < 0 ? -1 : 1);
+    outputY = (int)(ay >> 16) * (inputY < 0 ? -1 : 1);
+}
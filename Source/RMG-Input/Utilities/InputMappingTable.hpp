@@ -0,0 +1,104 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef INPUTMAPPINGTABLE_HPP
+#define INPUTMAPPINGTABLE_HPP
+
+#include "InputDeviceState.hpp"
+#include "common.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// maximum amount of mappings for all buttons
+#define INPUT_MAPPING_TABLE_MAX_BUTTON_ENTRIES 128
+// maximum amount of mappings per analog stick direction
+#define INPUT_MAPPING_TABLE_MAX_AXIS_ENTRIES   16
+// maximum amount of hotkeys
+#define INPUT_MAPPING_TABLE_MAX_HOTKEYS        64
+// maximum amount of distinct inputs used by all hotkeys
+#define INPUT_MAPPING_TABLE_MAX_HOTKEY_INPUTS  64
+
+namespace Utilities
+{
+// flat mapping table compiled from an input profile,
+// evaluating it doesn't allocate or walk any mapping lists
+class InputMappingTable
+{
+public:
+    // removes all mappings
+    void Clear(void);
+
+    // adds the mappings of an N64 button,
+    // returns false when the table is full
+    bool AddButtonMapping(N64ControllerButton button, const std::vector<int>& types,
+        const std::vector<int>& data, const std::vector<int>& extraData, int count);
+
+    // adds the mappings of an analog stick direction,
+    // returns false when the table is full
+    bool AddAxisMapping(InputAxisDirection direction, const std::vector<int>& types,
+        const std::vector<int>& data, const std::vector<int>& extraData, int count);
+
+    // adds the mappings of a hotkey, all of them
+    // have to be pressed for the hotkey to be pressed,
+    // returns false when the table is full
+    bool AddHotkeyMapping(int hotkey, const std::vector<int>& types,
+        const std::vector<int>& data, const std::vector<int>& extraData, int count);
+
+    // precomputes the analog stick response,
+    // deadzone and sensitivity are percentages
+    void SetAnalogStickResponse(int deadzone, int sensitivity);
+
+    // returns the value of the BUTTONS union
+    uint32_t Evaluate(const InputDeviceState& deviceState, const bool* keyboardState) const;
+
+    // returns the bitmask of the pressed hotkeys,
+    // bit N is set when hotkey N is pressed
+    uint64_t EvaluateHotkeys(const InputDeviceState& deviceState, const bool* keyboardState) const;
+
+private:
+    struct Entry
+    {
+        uint8_t  Source;
+        uint8_t  Output;
+        uint16_t Index;
+        int32_t  Sign;
+        int32_t  Threshold;
+    };
+
+    Entry buttonEntries[INPUT_MAPPING_TABLE_MAX_BUTTON_ENTRIES];
+    int   buttonEntryCount = 0;
+
+    Entry axisEntries[4][INPUT_MAPPING_TABLE_MAX_AXIS_ENTRIES];
+    int   axisEntryCount[4] = {0};
+
+    // every distinct input is evaluated once into
+    // a bit of the input mask, a hotkey is pressed
+    // when all bits of its mask are set
+    Entry    hotkeyInputs[INPUT_MAPPING_TABLE_MAX_HOTKEY_INPUTS];
+    int      hotkeyInputCount = 0;
+    uint64_t hotkeyMasks[INPUT_MAPPING_TABLE_MAX_HOTKEYS] = {0};
+    int      hotkeyCount = 0;
+
+    // analog stick response, the values are 16.16 fixed point,
+    // the scales are 32.32 fixed point,
+    // inputScale converts SDL axis values to N64 axis values
+    int64_t sensitivity    = 0;
+    int64_t inputScale     = 0;
+    int64_t maxAxis        = 0;
+    int64_t deadzone       = 0;
+    int64_t deadzoneScale  = 0;
+    int64_t diagonalFactor = 0;
+
+    bool compileEntry(Entry& entry, int type, int data, int extraData);
+    void simulateOctagon(int32_t inputX, int32_t inputY, int& outputX, int& outputY) const;
+};
+} // namespace Utilities
+
+#endif // INPUTMAPPINGTABLE_HPP
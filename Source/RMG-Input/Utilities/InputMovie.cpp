@@ -0,0 +1,311 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "InputMovie.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace Utilities;
+
+//
+// Local Defines
+//
+
+#define MOVIE_MAGIC       "RMGM"
+#define MOVIE_VERSION     1
+#define MOVIE_HEADER_SIZE 32
+
+// size of the chunks handed to the writer thread
+#define MOVIE_CHUNK_SIZE 4096
+
+//
+// Local Functions
+//
+
+static void write_u16(uint8_t* dst, uint16_t value)
+{
+    dst[0] = value & 0xff;
+    dst[1] = (value >> 8) & 0xff;
+}
+
+static void write_u32(uint8_t* dst, uint32_t value)
+{
+    write_u16(dst, value & 0xffff);
+    write_u16(dst + 2, value >> 16);
+}
+
+static uint16_t read_u16(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t* src)
+{
+    return read_u16(src) | ((uint32_t)read_u16(src + 2) << 16);
+}
+
+//
+// Exported Functions
+//
+
+InputMovie::~InputMovie(void)
+{
+    this->Stop();
+}
+
+bool InputMovie::StartRecording(std::string file, const InputMovieHeader& header)
+{
+    uint8_t headerData[MOVIE_HEADER_SIZE] = {0};
+
+    this->Stop();
+
+    FILE* movieFile = fopen(file.c_str(), "wb");
+    if (movieFile == nullptr)
+    {
+        return false;
+    }
+
+    memcpy(headerData, MOVIE_MAGIC, 4);
+    write_u16(headerData + 4, MOVIE_VERSION);
+    write_u16(headerData + 6, header.Start);
+    write_u32(headerData + 8, header.Controllers);
+    write_u32(headerData + 12, header.CRC1);
+    write_u32(headerData + 16, header.CRC2);
+
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+
+    this->reset();
+    this->buffer.assign(headerData, headerData + MOVIE_HEADER_SIZE);
+
+    this->writerThread = new Thread::MovieWriterThread(movieFile, nullptr);
+    this->writerThread->start();
+
+    this->isRecording = true;
+    return true;
+}
+
+bool InputMovie::StartPlayback(std::string file, InputMovieHeader& header)
+{
+    std::vector<uint8_t> movieData;
+    uint8_t readBuffer[MOVIE_CHUNK_SIZE];
+    size_t readSize;
+
+    this->Stop();
+
+    FILE* movieFile = fopen(file.c_str(), "rb");
+    if (movieFile == nullptr)
+    {
+        return false;
+    }
+
+    // the tokens are small, so read the whole movie,
+    // that way playing it back never touches the file
+    while ((readSize = fread(readBuffer, 1, sizeof(readBuffer), movieFile)) > 0)
+    {
+        movieData.insert(movieData.end(), readBuffer, readBuffer + readSize);
+    }
+    fclose(movieFile);
+
+    if (movieData.size() < MOVIE_HEADER_SIZE ||
+        memcmp(movieData.data(), MOVIE_MAGIC, 4) != 0 ||
+        read_u16(movieData.data() + 4) != MOVIE_VERSION)
+    {
+        return false;
+    }
+
+    header.Start       = read_u16(movieData.data() + 6);
+    header.Controllers = read_u32(movieData.data() + 8);
+    header.CRC1        = read_u32(movieData.data() + 12);
+    header.CRC2        = read_u32(movieData.data() + 16);
+
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+
+    this->reset();
+    this->data     = std::move(movieData);
+    this->position = MOVIE_HEADER_SIZE;
+
+    this->isPlaying = true;
+    return true;
+}
+
+void InputMovie::Stop(void)
+{
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+
+    if (this->isRecording)
+    {
+        this->writeRepeat();
+        this->writerThread->QueueData(std::move(this->buffer));
+        this->writerThread->StopLoop();
+        delete this->writerThread;
+        this->writerThread = nullptr;
+    }
+
+    this->isRecording = false;
+    this->isPlaying   = false;
+    this->data.clear();
+    this->buffer.clear();
+}
+
+bool InputMovie::IsRecording(void)
+{
+    return this->isRecording.load(std::memory_order_relaxed);
+}
+
+bool InputMovie::IsPlaying(void)
+{
+    return this->isPlaying.load(std::memory_order_relaxed);
+}
+
+bool InputMovie::HasDesynced(void)
+{
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+    return this->hasDesynced;
+}
+
+void InputMovie::Record(int control, uint32_t keys)
+{
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+
+    if (!this->isRecording || control < 0 || control >= INPUT_MOVIE_CONTROLLERS)
+    {
+        return;
+    }
+
+    if (keys == this->lastKeys[control])
+    {
+        this->repeatCount++;
+        return;
+    }
+
+    this->writeRepeat();
+    this->writeVarint(((uint64_t)control << 1) | 1);
+    this->buffer.resize(this->buffer.size() + 4);
+    write_u32(this->buffer.data() + this->buffer.size() - 4, keys);
+    this->lastKeys[control] = keys;
+
+    if (this->buffer.size() >= MOVIE_CHUNK_SIZE)
+    {
+        this->writerThread->QueueData(std::move(this->buffer));
+        this->buffer = std::vector<uint8_t>();
+        this->buffer.reserve(MOVIE_CHUNK_SIZE + 16);
+    }
+}
+
+bool InputMovie::Play(int control, uint32_t& keys)
+{
+    std::lock_guard<std::mutex> lock(this->movieMutex);
+
+    if (!this->isPlaying || control < 0 || control >= INPUT_MOVIE_CONTROLLERS)
+    {
+        return false;
+    }
+
+    if (this->repeatCount > 0)
+    {
+        this->repeatCount--;
+        keys = this->lastKeys[control];
+        return true;
+    }
+
+    uint64_t token;
+    if (!this->readVarint(token))
+    {
+        return false;
+    }
+
+    if ((token & 1) == 0)
+    { // run of unchanged keys, including this call
+        if ((token >> 1) == 0)
+        {
+            return false;
+        }
+
+        this->repeatCount = (token >> 1) - 1;
+        keys = this->lastKeys[control];
+        return true;
+    }
+
+    uint64_t tokenControl = token >> 1;
+    if (tokenControl >= INPUT_MOVIE_CONTROLLERS ||
+        (this->data.size() - this->position) < 4)
+    {
+        return false;
+    }
+
+    this->lastKeys[tokenControl] = read_u32(this->data.data() + this->position);
+    this->position += 4;
+
+    // the emulation requested a different controller
+    // than the one which was recorded, so we're out of sync
+    if (tokenControl != (uint64_t)control)
+    {
+        this->hasDesynced = true;
+    }
+
+    keys = this->lastKeys[control];
+    return true;
+}
+
+//
+// Private Functions
+//
+
+void InputMovie::reset(void)
+{
+    memset(this->lastKeys, 0, sizeof(this->lastKeys));
+    this->repeatCount = 0;
+    this->hasDesynced = false;
+    this->position    = 0;
+}
+
+void InputMovie::writeRepeat(void)
+{
+    if (this->repeatCount == 0)
+    {
+        return;
+    }
+
+    this->writeVarint(this->repeatCount << 1);
+    this->repeatCount = 0;
+}
+
+void InputMovie::writeVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        this->buffer.push_back((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+
+    this->buffer.push_back(value);
+}
+
+bool InputMovie::readVarint(uint64_t& value)
+{
+    int shift = 0;
+
+    value = 0;
+
+    while (this->position < this->data.size() && shift < 64)
+    {
+        uint8_t byte = this->data[this->position++];
+
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+
+        shift += 7;
+    }
+
+    return false;
+}
@@ -0,0 +1,102 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef INPUTMOVIE_HPP
+#define INPUTMOVIE_HPP
+
+#include "Thread/MovieWriterThread.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// amount of controllers in an input movie
+#define INPUT_MOVIE_CONTROLLERS 4
+
+namespace Utilities
+{
+// information stored in the header of an input movie
+struct InputMovieHeader
+{
+    // what the movie starts from,
+    // see m64p_input_movie_start
+    uint16_t Start = 0;
+    // bitmask of the plugged in controllers
+    uint32_t Controllers = 0;
+    // CRCs of the ROM the movie was recorded with
+    uint32_t CRC1 = 0;
+    uint32_t CRC2 = 0;
+};
+
+// records and plays back the keys of every GetKeys call,
+// the keys are stored as a stream of tokens:
+// a run of calls which returned the same keys as the previous
+// call for that controller, or new keys for a controller.
+//
+// Record() and Play() are meant to be called from
+// the emulation thread, the recording is written
+// to the file by a MovieWriterThread
+class InputMovie
+{
+public:
+    ~InputMovie(void);
+
+    // starts recording to the given file
+    bool StartRecording(std::string file, const InputMovieHeader& header);
+
+    // starts playing back the given file,
+    // header is set to the header of the movie
+    bool StartPlayback(std::string file, InputMovieHeader& header);
+
+    // stops recording or playing back,
+    // the recording is written in the background
+    void Stop(void);
+
+    bool IsRecording(void);
+    bool IsPlaying(void);
+
+    // returns whether the controllers which were
+    // played back didn't match the ones in the movie
+    bool HasDesynced(void);
+
+    // records the keys of the controller
+    void Record(int control, uint32_t keys);
+
+    // retrieves the recorded keys of the controller,
+    // returns false when the movie has ended
+    bool Play(int control, uint32_t& keys);
+
+private:
+    std::mutex movieMutex;
+    std::atomic<bool> isRecording = {false};
+    std::atomic<bool> isPlaying = {false};
+
+    uint32_t lastKeys[INPUT_MOVIE_CONTROLLERS] = {};
+    uint64_t repeatCount = 0;
+    bool hasDesynced = false;
+
+    // recording
+    Thread::MovieWriterThread* writerThread = nullptr;
+    std::vector<uint8_t> buffer;
+
+    // playback
+    std::vector<uint8_t> data;
+    size_t position = 0;
+
+    void reset(void);
+
+    void writeRepeat(void);
+    void writeVarint(uint64_t value);
+    bool readVarint(uint64_t& value);
+};
+} // namespace Utilities
+
+#endif // INPUTMOVIE_HPP
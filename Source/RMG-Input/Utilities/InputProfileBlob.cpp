@@ -0,0 +1,506 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "InputProfileBlob.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+using namespace Utilities;
+
+//
+// Local Defines
+//
+
+#define BLOB_MAGIC       "RMGP"
+// has to be increased when the order or
+// the type of the values in load_settings changes
+#define BLOB_VERSION     3
+#define BLOB_HEADER_SIZE 28
+
+// record types
+#define RECORD_INT         0
+#define RECORD_BOOL        1
+#define RECORD_STRING      2
+#define RECORD_INT_LIST    3
+#define RECORD_STRING_LIST 4
+#define RECORD_KEY_EXISTS  5
+
+// key of Input_ProfileHash
+#define SECTION_HASH_KEY "ProfileHash"
+
+//
+// Local Functions
+//
+
+static void write_u32(uint8_t* dst, uint32_t value)
+{
+    dst[0] = value & 0xff;
+    dst[1] = (value >> 8) & 0xff;
+    dst[2] = (value >> 16) & 0xff;
+    dst[3] = (value >> 24) & 0xff;
+}
+
+static uint32_t read_u32(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static uint64_t read_u64(const uint8_t* src)
+{
+    return read_u32(src) | ((uint64_t)read_u32(src + 4) << 32);
+}
+
+static uint64_t hash_data(const uint8_t* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    // 64bit FNV-1a
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// hashes the keys & values of the section,
+// except the hash which is stored in it,
+// this reads the whole section, so it's only
+// done when the section is saved or has no hash
+static bool hash_section(const std::string& section, uint64_t& hash)
+{
+    std::vector<std::pair<std::string, std::string>> values;
+
+    if (!CoreSettingsGetSectionValues(section, values))
+    {
+        return false;
+    }
+
+    hash = hash_data((const uint8_t*)section.data(), section.size() + 1);
+    for (const auto& value : values)
+    {
+        if (value.first == SECTION_HASH_KEY)
+        {
+            continue;
+        }
+
+        // include the terminators, so moving
+        // characters between key & value changes the hash
+        hash = hash_data((const uint8_t*)value.first.c_str(), value.first.size() + 1, hash);
+        hash = hash_data((const uint8_t*)value.second.c_str(), value.second.size() + 1, hash);
+    }
+
+    return true;
+}
+
+static std::string hash_to_string(uint64_t hash)
+{
+    char hashString[17];
+    snprintf(hashString, sizeof(hashString), "%016llx", (unsigned long long)hash);
+    return std::string(hashString);
+}
+
+// reads the hash which has been stored in the section
+static bool read_section_hash(const std::string& section, uint64_t& hash)
+{
+    std::string hashString;
+    char* hashStringEnd;
+
+    if (!CoreSettingsKeyExists(section, SECTION_HASH_KEY))
+    {
+        return false;
+    }
+
+    hashString = CoreSettingsGetStringValue(SettingsID::Input_ProfileHash, section);
+    if (hashString.size() != 16)
+    {
+        return false;
+    }
+
+    hash = strtoull(hashString.c_str(), &hashStringEnd, 16);
+    return *hashStringEnd == '\0';
+}
+
+static std::filesystem::path get_blob_path(const std::string& section)
+{
+    std::filesystem::path path;
+
+    path = CoreGetUserCacheDirectory();
+    path += "/InputProfiles/";
+    path += hash_to_string(hash_data((const uint8_t*)section.data(), section.size()));
+    path += ".blob";
+
+    return path;
+}
+
+//
+// Exported Functions
+//
+
+bool InputProfileBlob::Load(std::string section)
+{
+    std::vector<uint8_t> blobData;
+    uint8_t readBuffer[4096];
+    size_t readSize;
+    std::string blobSection;
+
+    this->section  = section;
+    this->mode     = Mode::Recording;
+    this->position = 0;
+    this->data.clear();
+    this->writeString(section);
+
+    // only the stored hash is read, not the whole section
+    this->hasSectionHash = read_section_hash(section, this->sectionHash);
+    if (!this->hasSectionHash)
+    {
+        return false;
+    }
+
+    FILE* blobFile = fopen(get_blob_path(section).string().c_str(), "rb");
+    if (blobFile == nullptr)
+    {
+        return false;
+    }
+
+    while ((readSize = fread(readBuffer, 1, sizeof(readBuffer), blobFile)) > 0)
+    {
+        blobData.insert(blobData.end(), readBuffer, readBuffer + readSize);
+    }
+    fclose(blobFile);
+
+    if (blobData.size() < BLOB_HEADER_SIZE ||
+        memcmp(blobData.data(), BLOB_MAGIC, 4) != 0 ||
+        read_u32(blobData.data() + 4) != BLOB_VERSION ||
+        read_u32(blobData.data() + 24) != blobData.size() - BLOB_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    // the data hash guards against a corrupted blob,
+    // the section hash has to match the hash stored
+    // in the section, else the section has been
+    // saved again after compiling the blob
+    const uint64_t dataHash = hash_data(blobData.data() + BLOB_HEADER_SIZE, blobData.size() - BLOB_HEADER_SIZE);
+    if (dataHash != read_u64(blobData.data() + 8) ||
+        this->sectionHash != read_u64(blobData.data() + 16))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> recordedData = std::move(this->data);
+    this->data = std::move(blobData);
+    this->position = BLOB_HEADER_SIZE;
+
+    // guard against hash collisions of the section names
+    if (!this->readString(blobSection) || blobSection != section)
+    {
+        this->data = std::move(recordedData);
+        this->position = 0;
+        return false;
+    }
+
+    this->recordPosition = this->position;
+    this->mode = Mode::Replaying;
+    return true;
+}
+
+bool InputProfileBlob::StoreSectionHash(std::string section, uint64_t& hash)
+{
+    if (!hash_section(section, hash))
+    {
+        return false;
+    }
+
+    return CoreSettingsSetValue(SettingsID::Input_ProfileHash, section, hash_to_string(hash));
+}
+
+bool InputProfileBlob::IsRecording(void)
+{
+    return this->mode == Mode::Recording;
+}
+
+bool InputProfileBlob::Save(void)
+{
+    uint8_t header[BLOB_HEADER_SIZE];
+    std::filesystem::path path = get_blob_path(this->section);
+    std::error_code errorCode;
+
+    if (this->mode != Mode::Recording)
+    {
+        return false;
+    }
+
+    // the section has no hash yet, i.e it hasn't
+    // been saved by the input dialog, so store one
+    if (!this->hasSectionHash)
+    {
+        this->hasSectionHash = StoreSectionHash(this->section, this->sectionHash);
+        if (!this->hasSectionHash)
+        {
+            return false;
+        }
+    }
+
+    const uint64_t dataHash = hash_data(this->data.data(), this->data.size());
+
+    memcpy(header, BLOB_MAGIC, 4);
+    write_u32(header + 4, BLOB_VERSION);
+    write_u32(header + 8, dataHash & 0xffffffff);
+    write_u32(header + 12, dataHash >> 32);
+    write_u32(header + 16, this->sectionHash & 0xffffffff);
+    write_u32(header + 20, this->sectionHash >> 32);
+    write_u32(header + 24, (uint32_t)this->data.size());
+
+    std::filesystem::create_directories(path.parent_path(), errorCode);
+
+    FILE* blobFile = fopen(path.string().c_str(), "wb");
+    if (blobFile == nullptr)
+    {
+        return false;
+    }
+
+    bool ret = fwrite(header, 1, sizeof(header), blobFile) == sizeof(header) &&
+               fwrite(this->data.data(), 1, this->data.size(), blobFile) == this->data.size();
+    ret = (fclose(blobFile) == 0) && ret;
+
+    return ret;
+}
+
+bool InputProfileBlob::KeyExists(std::string key)
+{
+    std::string recordedKey;
+    uint32_t value;
+
+    if (this->replayRecord(RECORD_KEY_EXISTS, 0))
+    {
+        if (this->readString(recordedKey) && recordedKey == key && this->readU32(value))
+        {
+            return value != 0;
+        }
+        this->startRecording();
+    }
+
+    bool exists = CoreSettingsKeyExists(this->section, key);
+    this->writeRecord(RECORD_KEY_EXISTS, 0);
+    this->writeString(key);
+    this->writeU32(exists ? 1 : 0);
+    return exists;
+}
+
+int InputProfileBlob::GetIntValue(SettingsID settingId)
+{
+    uint32_t value;
+
+    if (this->replayRecord(RECORD_INT, (uint32_t)settingId))
+    {
+        if (this->readU32(value))
+        {
+            return (int)value;
+        }
+        this->startRecording();
+    }
+
+    int intValue = CoreSettingsGetIntValue(settingId, this->section);
+    this->writeRecord(RECORD_INT, (uint32_t)settingId);
+    this->writeU32((uint32_t)intValue);
+    return intValue;
+}
+
+bool InputProfileBlob::GetBoolValue(SettingsID settingId)
+{
+    uint32_t value;
+
+    if (this->replayRecord(RECORD_BOOL, (uint32_t)settingId))
+    {
+        if (this->readU32(value))
+        {
+            return value != 0;
+        }
+        this->startRecording();
+    }
+
+    bool boolValue = CoreSettingsGetBoolValue(settingId, this->section);
+    this->writeRecord(RECORD_BOOL, (uint32_t)settingId);
+    this->writeU32(boolValue ? 1 : 0);
+    return boolValue;
+}
+
+std::string InputProfileBlob::GetStringValue(SettingsID settingId)
+{
+    std::string value;
+
+    if (this->replayRecord(RECORD_STRING, (uint32_t)settingId))
+    {
+        if (this->readString(value))
+        {
+            return value;
+        }
+        this->startRecording();
+    }
+
+    value = CoreSettingsGetStringValue(settingId, this->section);
+    this->writeRecord(RECORD_STRING, (uint32_t)settingId);
+    this->writeString(value);
+    return value;
+}
+
+std::vector<int> InputProfileBlob::GetIntListValue(SettingsID settingId)
+{
+    std::vector<int> value;
+    uint32_t count;
+    uint32_t element;
+
+    if (this->replayRecord(RECORD_INT_LIST, (uint32_t)settingId))
+    {
+        bool ret = this->readU32(count) && count <= (this->data.size() - this->position) / 4;
+        for (uint32_t i = 0; ret && i < count; i++)
+        {
+            ret = this->readU32(element);
+            value.push_back((int)element);
+        }
+
+        if (ret)
+        {
+            return value;
+        }
+        this->startRecording();
+    }
+
+    value = CoreSettingsGetIntListValue(settingId, this->section);
+    this->writeRecord(RECORD_INT_LIST, (uint32_t)settingId);
+    this->writeU32((uint32_t)value.size());
+    for (const int intValue : value)
+    {
+        this->writeU32((uint32_t)intValue);
+    }
+    return value;
+}
+
+std::vector<std::string> InputProfileBlob::GetStringListValue(SettingsID settingId)
+{
+    std::vector<std::string> value;
+    uint32_t count;
+    std::string element;
+
+    if (this->replayRecord(RECORD_STRING_LIST, (uint32_t)settingId))
+    {
+        bool ret = this->readU32(count) && count <= (this->data.size() - this->position) / 4;
+        for (uint32_t i = 0; ret && i < count; i++)
+        {
+            ret = this->readString(element);
+            value.push_back(element);
+        }
+
+        if (ret)
+        {
+            return value;
+        }
+        this->startRecording();
+    }
+
+    value = CoreSettingsGetStringListValue(settingId, this->section);
+    this->writeRecord(RECORD_STRING_LIST, (uint32_t)settingId);
+    this->writeU32((uint32_t)value.size());
+    for (const std::string& stringValue : value)
+    {
+        this->writeString(stringValue);
+    }
+    return value;
+}
+
+bool InputProfileBlob::replayRecord(uint8_t type, uint32_t id)
+{
+    uint32_t record;
+
+    if (this->mode != Mode::Replaying)
+    {
+        return false;
+    }
+
+    this->recordPosition = this->position;
+
+    // the record has to be exactly what we're
+    // reading, else the blob can't be trusted
+    // anymore and we'll read from the settings
+    if (!this->readU32(record) || record != (((uint32_t)type << 24) | id))
+    {
+        this->startRecording();
+        return false;
+    }
+
+    return true;
+}
+
+void InputProfileBlob::startRecording(void)
+{
+    // the records before the current one match
+    // the reads, so keep them and record the
+    // remaining values, Save() then replaces the blob
+    this->data.resize(this->recordPosition);
+    this->data.erase(this->data.begin(), this->data.begin() + BLOB_HEADER_SIZE);
+    this->position = 0;
+    this->mode = Mode::Recording;
+}
+
+void InputProfileBlob::writeRecord(uint8_t type, uint32_t id)
+{
+    this->writeU32(((uint32_t)type << 24) | (id & 0xffffff));
+}
+
+bool InputProfileBlob::readU32(uint32_t& value)
+{
+    if (this->data.size() - this->position < 4)
+    {
+        return false;
+    }
+
+    value = read_u32(this->data.data() + this->position);
+    this->position += 4;
+    return true;
+}
+
+bool InputProfileBlob::readString(std::string& value)
+{
+    uint32_t size;
+
+    if (!this->readU32(size) || this->data.size() - this->position < size)
+    {
+        return false;
+    }
+
+    value.assign((const char*)this->data.data() + this->position, size);
+    this->position += size;
+    return true;
+}
+
+void InputProfileBlob::writeU32(uint32_t value)
+{
+    if (this->mode != Mode::Recording)
+    {
+        return;
+    }
+
+    uint8_t buffer[4];
+    write_u32(buffer, value);
+    this->data.insert(this->data.end(), buffer, buffer + 4);
+}
+
+void InputProfileBlob::writeString(const std::string& value)
+{
+    if (this->mode != Mode::Recording)
+    {
+        return;
+    }
+
+    this->writeU32((uint32_t)value.size());
+    this->data.insert(this->data.end(), value.begin(), value.end());
+}
@@ -0,0 +1,98 @@
+/*
+ * Rosalie's Mupen GUI - https://github.com/Rosalie241/RMG
+ *  Copyright (C) 2020 Rosalie Wanders <rosalie@mailbox.org>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License version 3.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef INPUTPROFILEBLOB_HPP
+#define INPUTPROFILEBLOB_HPP
+
+#include <RMG-Core/Core.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Utilities
+{
+// reads the settings of an input profile section,
+// either from the compiled blob of the section,
+// which only takes a single file read, or from the
+// settings, the values read from the settings are
+// recorded, so Save() can compile them into a new blob.
+//
+// the input dialog stores a hash of the keys & values
+// of a section in the section when saving it, the blob
+// is only used when that hash matches the one stored
+// in the blob, so validating it doesn't require reading
+// the whole section. sections without a hash get one
+// when their blob is compiled, a hand-edited section
+// keeps using its old blob until its hash is removed.
+// the values have to be read in the same order
+// as they've been recorded
+class InputProfileBlob
+{
+public:
+    // loads the blob of the section, returns false
+    // when it's missing or stale, the values will
+    // then be read from the settings & recorded,
+    // which also happens when the blob doesn't
+    // match the reads halfway through
+    bool Load(std::string section);
+
+    // hashes the keys & values of the section
+    // and stores the hash in the section
+    static bool StoreSectionHash(std::string section, uint64_t& hash);
+
+    // returns whether the values are being recorded
+    bool IsRecording(void);
+
+    // writes the recorded values as blob of the section
+    bool Save(void);
+
+    bool KeyExists(std::string key);
+
+    int GetIntValue(SettingsID settingId);
+    bool GetBoolValue(SettingsID settingId);
+    std::string GetStringValue(SettingsID settingId);
+    std::vector<int> GetIntListValue(SettingsID settingId);
+    std::vector<std::string> GetStringListValue(SettingsID settingId);
+
+private:
+    enum class Mode
+    {
+        // values are recorded for a new blob
+        Recording,
+        // values are read from the blob
+        Replaying,
+    };
+
+    std::string section;
+    uint64_t sectionHash = 0;
+    bool hasSectionHash = false;
+    Mode mode = Mode::Recording;
+
+    std::vector<uint8_t> data;
+    size_t position = 0;
+    // position of the record which is being replayed
+    size_t recordPosition = 0;
+
+    // returns whether the next value can be read from the blob,
+    // switches to recording when it can't
+    bool replayRecord(uint8_t type, uint32_t id);
+    // keeps the replayed records and records
+    // the remaining values from the settings
+    void startRecording(void);
+    void writeRecord(uint8_t type, uint32_t id);
+
+    bool readU32(uint32_t& value);
+    bool readString(std::string& value);
+    void writeU32(uint32_t value);
+    void writeString(const std::string& value);
+};
+} // namespace Utilities
+
+#endif // INPUTPROFILEBLOB_HPP
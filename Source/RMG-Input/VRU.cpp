@@ -16,6 +16,8 @@
 #include <../3rdParty/vosk-api/include/vosk_api.h>
 
 #include <iostream>
+#include <atomic>
+#include <mutex>
 
 #include <QByteArray>
 #include <QStringDecoder>
@@ -26,9 +28,17 @@
 
 #include <SDL.h>
 
+#include "Thread/VRUThread.hpp"
 #include "VRU.hpp"
 #include "VRUwords.hpp"
 
+//
+// Local Defines
+//
+
+// maximum amount of recognizers which are kept
+#define VRU_MAX_RECOGNIZERS 8
+
 //
 // Local Enums
 //
@@ -54,6 +64,7 @@ typedef int             (*ptr_vosk_recognizer_accept_waveform)(VoskRecognizer *,
 typedef const char *    (*ptr_vosk_recognizer_final_result)(VoskRecognizer *);
 typedef void            (*ptr_vosk_set_log_level)(int);
 typedef void            (*ptr_vosk_recognizer_set_max_alternatives)(VoskRecognizer *, int);
+typedef void            (*ptr_vosk_recognizer_reset)(VoskRecognizer *);
 
 static ptr_vosk_model_new                       l_vosk_model_new = nullptr;
 static ptr_vosk_model_free                      l_vosk_model_free = nullptr;
@@ -63,17 +74,44 @@ static ptr_vosk_recognizer_accept_waveform      l_vosk_recognizer_accept_wavefor
 static ptr_vosk_recognizer_final_result         l_vosk_recognizer_final_result = nullptr;
 static ptr_vosk_set_log_level                   l_vosk_set_log_level = nullptr;
 static ptr_vosk_recognizer_set_max_alternatives l_vosk_recognizer_set_max_alternatives = nullptr;
+static ptr_vosk_recognizer_reset                l_vosk_recognizer_reset = nullptr;
 
 static osal_dynlib_lib_handle l_VoskLibHandle = nullptr;
 
 static VoskModel* l_VoskModel           = nullptr;
 static VoskRecognizer* l_VoskRecognizer = nullptr;
 
+// the model is loaded by VRUThread, l_VoskModelReady
+// is set once it can be used, l_VoskModelFailed when
+// it couldn't be loaded
+static std::atomic<bool> l_VoskModelReady  = false;
+static std::atomic<bool> l_VoskModelFailed = false;
+
+// recognizers which have been created for a grammar,
+// so games which register the same word list again
+// don't have to wait for a new recognizer
+struct VoskRecognizerEntry
+{
+    std::string     Grammar;
+    int             SampleRate;
+    VoskRecognizer* Recognizer;
+};
+
+static std::vector<VoskRecognizerEntry> l_VoskRecognizers;
+
+// guards the recognizers, the grammar and the result,
+// the recognizer is created and fed by VRUThread
+static std::mutex  l_VoskRecognizerMutex;
+static std::string l_VoskGrammar;
+static std::string l_VoskResult;
+static bool        l_VoskResultError = false;
+
 // VRU implementation variables
 //
+// whether VRUThread has been started
 static bool l_Initialized = false;
-
-static std::vector<VRUWordEntry> l_WordEntries;
+// whether the mic has been opened for the ROM
+static bool l_Opened      = false;
 
 static int l_MicState      = 0;
 static int l_WordListSize  = 0;
@@ -85,6 +123,8 @@ static QList<int>  l_RegisteredWordsIndex;
 static SDL_AudioDeviceID l_AudioDevice = 0;
 static SDL_AudioSpec     l_AudioDeviceSpec;
 
+static Thread::VRUThread* l_VRUThread = nullptr;
+
 //
 // Local Functions
 //
@@ -116,6 +156,7 @@ static bool hook_vosk(void)
     l_vosk_recognizer_final_result = (ptr_vosk_recognizer_final_result) osal_dynlib_sym(l_VoskLibHandle, "vosk_recognizer_final_result");
     l_vosk_set_log_level = (ptr_vosk_set_log_level) osal_dynlib_sym(l_VoskLibHandle, "vosk_set_log_level");
     l_vosk_recognizer_set_max_alternatives = (ptr_vosk_recognizer_set_max_alternatives) osal_dynlib_sym(l_VoskLibHandle, "vosk_recognizer_set_max_alternatives");
+    l_vosk_recognizer_reset = (ptr_vosk_recognizer_reset) osal_dynlib_sym(l_VoskLibHandle, "vosk_recognizer_reset");
 
     if (l_vosk_model_new == nullptr ||
         l_vosk_model_free == nullptr ||
@@ -124,7 +165,8 @@ static bool hook_vosk(void)
         l_vosk_recognizer_accept_waveform == nullptr ||
         l_vosk_recognizer_final_result == nullptr ||
         l_vosk_set_log_level == nullptr ||
-        l_vosk_recognizer_set_max_alternatives == nullptr)
+        l_vosk_recognizer_set_max_alternatives == nullptr ||
+        l_vosk_recognizer_reset == nullptr)
     {
         debugMessage = "VRU: Failed to open library: missing functions";
         CoreDebugCallbackMessage(CoreDebugMessageType::Error, debugMessage);
@@ -144,8 +186,13 @@ static void unhook_vosk(void)
     l_vosk_recognizer_final_result = nullptr;
     l_vosk_set_log_level = nullptr;
     l_vosk_recognizer_set_max_alternatives = nullptr;
+    l_vosk_recognizer_reset = nullptr;
 
-    osal_dynlib_close(l_VoskLibHandle);
+    if (l_VoskLibHandle != nullptr)
+    {
+        osal_dynlib_close(l_VoskLibHandle);
+        l_VoskLibHandle = nullptr;
+    }
 }
 
 static bool setup_vosk_model(void)
@@ -238,17 +285,72 @@ static bool init_vosk(void)
 
 static void quit_vosk(void)
 {
+    for (VoskRecognizerEntry& entry : l_VoskRecognizers)
+    {
+        l_vosk_recognizer_free(entry.Recognizer);
+    }
+    l_VoskRecognizers.clear();
+    l_VoskRecognizer = nullptr;
+
     if (l_VoskModel != nullptr)
     {
         l_vosk_model_free(l_VoskModel);
         l_VoskModel = nullptr;
     }
+}
+
+// extracts and loads the model,
+// called by VRUThread when it starts
+static void load_vosk_model(void)
+{
+    if (!hook_vosk())
+    {
+        unhook_vosk();
+        l_VoskModelFailed = true;
+        return;
+    }
 
-    if (l_VoskRecognizer != nullptr)
+    if (!setup_vosk_model() || !init_vosk())
     {
-        l_vosk_recognizer_free(l_VoskRecognizer);
-        l_VoskRecognizer = nullptr;
+        unhook_vosk();
+        l_VoskModelFailed = true;
+        return;
+    }
+
+    l_VoskModelReady = true;
+}
+
+// returns the recognizer for the grammar, re-uses an
+// earlier recognizer for the same grammar when possible,
+// expects l_VoskRecognizerMutex to be locked
+static VoskRecognizer* get_vosk_recognizer(const std::string& grammar)
+{
+    for (VoskRecognizerEntry& entry : l_VoskRecognizers)
+    {
+        if (entry.Grammar == grammar && entry.SampleRate == l_AudioDeviceSpec.freq)
+        {
+            l_vosk_recognizer_reset(entry.Recognizer);
+            return entry.Recognizer;
+        }
+    }
+
+    VoskRecognizer* recognizer = l_vosk_recognizer_new_grm(l_VoskModel, (float)l_AudioDeviceSpec.freq, grammar.c_str());
+    if (recognizer == nullptr)
+    {
+        return nullptr;
+    }
+
+    l_vosk_recognizer_set_max_alternatives(recognizer, 3);
+
+    // free the oldest recognizer when there are too many
+    if (l_VoskRecognizers.size() == VRU_MAX_RECOGNIZERS)
+    {
+        l_vosk_recognizer_free(l_VoskRecognizers.front().Recognizer);
+        l_VoskRecognizers.erase(l_VoskRecognizers.begin());
     }
+
+    l_VoskRecognizers.push_back({grammar, l_AudioDeviceSpec.freq, recognizer});
+    return recognizer;
 }
 
 static bool init_mic(void)
@@ -280,38 +382,70 @@ static void quit_mic(void)
     if (l_AudioDevice != 0)
     {
         SDL_CloseAudioDevice(l_AudioDevice);
+        l_AudioDevice = 0;
     }
 }
 
-static QByteArray words_to_byte_array(uint16_t* words, uint16_t size)
+// hands the captured audio to vosk in small chunks,
+// called by VRUThread while the mic is held
+static void feed_audio(void)
 {
-    QByteArray byte_array;
+    char     buffer[4096];
+    uint32_t size;
 
-    uint8_t* bytes = (uint8_t*)words;
+    std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
 
-    for (int i = 0; i < (size * 2); i += 2)
+    // create the recognizer when the game has
+    // registered its words and the model is ready
+    if (l_VoskRecognizer == nullptr && !l_VoskGrammar.empty() && l_VoskModelReady)
     {
-        byte_array.push_back(bytes[i + 1]);
-        byte_array.push_back(bytes[i]);
+        l_VoskRecognizer = get_vosk_recognizer(l_VoskGrammar);
     }
 
-    return byte_array;
+    if (l_VoskRecognizer == nullptr)
+    {
+        return;
+    }
+
+    while ((size = SDL_DequeueAudio(l_AudioDevice, buffer, sizeof(buffer))) > 0)
+    {
+        if (l_vosk_recognizer_accept_waveform(l_VoskRecognizer, buffer, size) == -1)
+        {
+            l_VoskResultError = true;
+        }
+    }
 }
 
-static bool find_word_from_hex(std::string hex, std::string& word)
+// hands the remaining audio to vosk and retrieves
+// the result, called by VRUThread when the mic is released
+static void finish_audio(void)
 {
-    auto predicate = [hex](const VRUWordEntry& entry)
+    feed_audio();
+
+    std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+
+    if (l_VoskRecognizer == nullptr)
     {
-        return entry.hex == hex;
-    };
+        l_VoskResult.clear();
+        return;
+    }
+
+    l_VoskResult = l_vosk_recognizer_final_result(l_VoskRecognizer);
+}
+
+static QByteArray words_to_byte_array(uint16_t* words, uint16_t size)
+{
+    QByteArray byte_array;
 
-    auto iter = std::find_if(l_WordEntries.begin(), l_WordEntries.end(), predicate);
-    if (iter != l_WordEntries.end())
+    uint8_t* bytes = (uint8_t*)words;
+
+    for (int i = 0; i < (size * 2); i += 2)
     {
-        word = (*iter).words;
+        byte_array.push_back(bytes[i + 1]);
+        byte_array.push_back(bytes[i]);
     }
 
-    return iter != l_WordEntries.end();
+    return byte_array;
 }
 
 //
@@ -322,20 +456,41 @@ bool InitVRU(void)
 {
     if (l_Initialized)
     {
-        return true;
-    }
+        // retry loading the model when it failed
+        // before, i.e when it couldn't be downloaded
+        if (!l_VoskModelFailed)
+        {
+            return true;
+        }
 
-    if (!hook_vosk())
-    {
-        return false;
+        QuitVRU();
     }
 
-    if (!setup_vosk_model())
+    l_VoskModelReady  = false;
+    l_VoskModelFailed = false;
+
+    // the model is loaded in the background,
+    // so it doesn't block starting the ROM
+    l_VRUThread = new Thread::VRUThread(load_vosk_model, feed_audio, finish_audio, nullptr);
+    l_VRUThread->start();
+
+    l_Initialized = true;
+    return true;
+}
+
+bool IsVRUReady(void)
+{
+    return l_VoskModelReady;
+}
+
+bool OpenVRU(void)
+{
+    if (l_Opened)
     {
-        return false;
+        return true;
     }
 
-    if (!init_vosk())
+    if (!InitVRU() || l_VoskModelFailed)
     {
         return false;
     }
@@ -347,18 +502,37 @@ bool InitVRU(void)
 
     l_MicState = 0;
 
-    if (l_WordEntries.empty())
-    {
-        l_WordEntries = GetVRUWordEntries();
-    }
-
-    l_Initialized = true;
+    l_Opened = true;
     return true;
 }
 
-bool IsVRUInit(void)
+void CloseVRU(void)
 {
-    return l_Initialized;
+    if (!l_Opened)
+    {
+        return;
+    }
+
+    l_VRUThread->StopListening();
+    l_VRUThread->WaitForResult();
+
+    quit_mic();
+
+    {
+        std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+        l_VoskRecognizer = nullptr;
+        l_VoskGrammar.clear();
+        l_VoskResult.clear();
+        l_VoskResultError = false;
+    }
+
+    l_RegisteredWords.clear();
+    l_RegisteredWordsIndex.clear();
+    l_WordListCount = 0;
+    l_WordListSize  = 0;
+    l_MicState      = 0;
+
+    l_Opened = false;
 }
 
 bool QuitVRU(void)
@@ -368,11 +542,20 @@ bool QuitVRU(void)
         return false;
     }
 
-    quit_mic();
-    quit_vosk();
-    unhook_vosk();
+    CloseVRU();
+
+    l_VRUThread->StopLoop();
+    l_VRUThread->deleteLater();
+    l_VRUThread = nullptr;
+
+    if (l_VoskModelReady)
+    {
+        quit_vosk();
+        unhook_vosk();
+    }
 
-    l_Initialized = false;
+    l_VoskModelReady = false;
+    l_Initialized    = false;
     return true;
 }
 
@@ -387,22 +570,22 @@ int GetVRUMicState(void)
 
 EXPORT void CALL SendVRUWord(uint16_t length, uint16_t* word, uint8_t lang)
 {
-    if (!l_Initialized)
+    if (!l_Opened)
     {
         return;
     }
 
-    QByteArray byte_array = words_to_byte_array(word, length);
     std::string debugMessage;
-    std::string word_str;
+    const char* words = FindVRUWords(word, length);
 
-    if (find_word_from_hex(byte_array.toHex().toUpper().toStdString(), word_str))
+    if (words != nullptr)
     { // found word
-        l_RegisteredWords.append(QString::fromStdString(word_str));
+        l_RegisteredWords.append(QString::fromUtf8(words));
         l_RegisteredWordsIndex.append(l_WordListCount);
     }
     else
     { // not found
+        QByteArray byte_array = words_to_byte_array(word, length);
         QStringDecoder utf8_decoder = QStringDecoder(QStringDecoder::Utf8);
         QString encoded_string = utf8_decoder.decode(byte_array);
 
@@ -431,37 +614,40 @@ EXPORT void CALL SendVRUWord(uint16_t length, uint16_t* word, uint8_t lang)
         QJsonDocument json_document;
         json_document.setArray(QJsonArray::fromStringList(l_RegisteredWords));
 
-        // free existing recognizer if needed
-        if (l_VoskRecognizer)
-        {
-            l_vosk_recognizer_free(l_VoskRecognizer);
-            l_VoskRecognizer = nullptr;
-        }
-
-        // try to create a new recognizer
-        l_VoskRecognizer = l_vosk_recognizer_new_grm(l_VoskModel, (float)l_AudioDeviceSpec.freq, json_document.toJson().constData());
-        if (l_VoskRecognizer != nullptr)
-        {
-            l_vosk_recognizer_set_max_alternatives(l_VoskRecognizer, 3);
-        }
+        // VRUThread creates the recognizer (or re-uses
+        // the one for the same grammar) once the model
+        // has been loaded
+        std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+        l_VoskGrammar    = json_document.toJson(QJsonDocument::Compact).toStdString();
+        l_VoskRecognizer = nullptr;
     }
 }
 
 EXPORT void CALL SetMicState(int state)
 {
-    if (!l_Initialized)
+    if (!l_Opened)
     {
         return;
     }
 
     if (state)
     {
+        // make sure the previous result doesn't
+        // need the audio which we're about to clear
+        l_VRUThread->WaitForResult();
+        {
+            std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+            l_VoskResult.clear();
+            l_VoskResultError = false;
+        }
         SDL_ClearQueuedAudio(l_AudioDevice);
         SDL_PauseAudioDevice(l_AudioDevice, 0);
+        l_VRUThread->StartListening();
     }
     else
     {
         SDL_PauseAudioDevice(l_AudioDevice, 1);
+        l_VRUThread->StopListening();
     }
 
     l_MicState = state;
@@ -469,11 +655,19 @@ EXPORT void CALL SetMicState(int state)
 
 EXPORT void CALL ReadVRUResults(uint16_t* error_flags, uint16_t* num_results, uint16_t* mic_level, uint16_t* voice_level, uint16_t* voice_length, uint16_t* matches)
 {
-    if (!l_Initialized || l_VoskRecognizer == nullptr)
+    if (!l_Opened)
     {
         return;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+        if (l_VoskGrammar.empty())
+        {
+            return;
+        }
+    }
+
     // initialize result data
     *num_results  = 0;
     *mic_level    = 0xBB8;
@@ -485,31 +679,43 @@ EXPORT void CALL ReadVRUResults(uint16_t* error_flags, uint16_t* num_results, ui
         matches[i + 1] = 0;
     }
 
-    // retrieve audio data from device
+    // VRUThread has already handed most of the audio
+    // to vosk, so we only have to wait for it to finish
     SDL_PauseAudioDevice(l_AudioDevice, 1);
+    l_VRUThread->StopListening();
+    l_VRUThread->WaitForResult();
 
-    void* audio_buf     = nullptr;
-    uint32_t audio_size = SDL_GetQueuedAudioSize(l_AudioDevice);
-
-    audio_buf = malloc(audio_size);
-    if (audio_buf == nullptr)
+    // the model is still being loaded,
+    // so nothing could've been recognized,
+    // when it failed to load after the ROM
+    // has been opened, the VRU reports an error
+    // until the next ROM retries loading it
+    if (!IsVRUReady())
     {
-        *error_flags = 0x8000;
+        if (l_VoskModelFailed)
+        {
+            *error_flags = 0x8000;
+        }
         return;
     }
 
-    audio_size = SDL_DequeueAudio(l_AudioDevice, audio_buf, audio_size);
+    std::string result;
+    bool resultError;
+    {
+        std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+        result      = std::move(l_VoskResult);
+        resultError = l_VoskResultError;
+        l_VoskResult.clear();
+        l_VoskResultError = false;
+    }
 
-    // hand audio data to vosk and retrieve results
-    int ret = l_vosk_recognizer_accept_waveform(l_VoskRecognizer, (const char*)audio_buf, audio_size);
-    if (ret == -1)
+    if (resultError)
     {
         *error_flags = 0x8000;
-        free(audio_buf);
         return;
     }
 
-    QJsonDocument json_document = QJsonDocument::fromJson(l_vosk_recognizer_final_result(l_VoskRecognizer));
+    QJsonDocument json_document = QJsonDocument::fromJson(QByteArray::fromStdString(result));
 
     // parse results from vosk
     QJsonArray alternatives_array = json_document.object().value("alternatives").toArray();
@@ -573,13 +779,11 @@ EXPORT void CALL ReadVRUResults(uint16_t* error_flags, uint16_t* num_results, ui
     }
 
     *num_results = found_words.size();
-
-    free(audio_buf);
 }
 
 EXPORT void CALL ClearVRUWords(uint8_t length)
 {
-    if (!l_Initialized)
+    if (!l_Opened)
     {
         return;
     }
@@ -590,11 +794,11 @@ EXPORT void CALL ClearVRUWords(uint8_t length)
     l_RegisteredWords.clear();
     l_RegisteredWordsIndex.clear();
 
-    if (l_VoskRecognizer != nullptr)
-    {
-        l_vosk_recognizer_free(l_VoskRecognizer);
-        l_VoskRecognizer = nullptr;
-    }
+    // the recognizer is kept, so it
+    // can be re-used for the same words
+    std::lock_guard<std::mutex> lock(l_VoskRecognizerMutex);
+    l_VoskGrammar.clear();
+    l_VoskRecognizer = nullptr;
 }
 
 EXPORT void CALL SetVRUWordMask(uint8_t length, uint8_t* mask)
@@ -10,13 +10,23 @@
 #ifndef VRU_HPP
 #define VRU_HPP
 
-// attempts to initialize VRU capabilities
+// starts loading the speech recognition
+// model in the background, retries when
+// loading it has failed before
 bool InitVRU(void);
 
-// returns whether VRU has been initialized
-bool IsVRUInit(void);
+// returns whether the speech recognition
+// model has been loaded
+bool IsVRUReady(void);
 
-// attempts to de-initialize VRY capabilities
+// attempts to open the mic for the ROM,
+// the model stays loaded after CloseVRU
+bool OpenVRU(void);
+
+// closes the mic and forgets the registered words
+void CloseVRU(void);
+
+// attempts to de-initialize VRU capabilities
 bool QuitVRU(void);
 
 int GetVRUMicState(void);
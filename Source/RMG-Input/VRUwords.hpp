@@ -10,15 +10,10 @@
 #ifndef VRU_WORDS_HPP
 #define VRU_WORDS_HPP
 
-#include <string>
-#include <vector>
+#include <cstdint>
 
-struct VRUWordEntry
-{
-    std::string hex;
-    std::string words;
-};
+// returns the words of the VRU word, which consists of
+// length 16-bit characters, returns nullptr when it's unknown
+const char* FindVRUWords(const uint16_t* word, uint16_t length);
 
-std::vector<VRUWordEntry> GetVRUWordEntries(void);
-
-#endif // VRU_WORDS_HPP
\ No newline at end of file
+#endif // VRU_WORDS_HPP
@@ -14,7 +14,14 @@
 #include <UserInterface/MainDialog.hpp>
 #include "Thread/SDLThread.hpp"
 #include "Thread/HotkeysThread.hpp"
+#include "Thread/HotkeyActionThread.hpp"
+#include "Thread/InputThread.hpp"
+#include "Thread/RumbleThread.hpp"
 #include "Utilities/InputDevice.hpp"
+#include "Utilities/InputMappingTable.hpp"
+#include "Utilities/FrameTimeStatistics.hpp"
+#include "Utilities/InputMovie.hpp"
+#include "Utilities/InputProfileBlob.hpp"
 #include "common.hpp"
 #ifdef VRU
 #include "VRU.hpp"
@@ -25,8 +32,12 @@
 #include <QGuiApplication>
 #include <QApplication>
 #include <SDL.h>
+#ifdef HIDAPI
+#include <hidapi.h>
+#endif // HIDAPI
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 
 //
@@ -34,8 +45,6 @@
 //
 
 #define NUM_CONTROLLERS    4
-#define N64_AXIS_PEAK      85
-#define MAX_DIAGONAL_VALUE 69
 #define DEADZONE_VALUE     7
 
 #define RD_GETSTATUS        0x00   // get status
@@ -52,6 +61,49 @@
 // Local Structures
 //
 
+// bit of the hotkey in the hotkey masks,
+// the order is also the order in which
+// actions are queued when pressed together
+enum class Hotkey
+{
+    Shutdown = 0,
+    Exit,
+    SoftReset,
+    Resume,
+    Screenshot,
+    LimitFPS,
+    SpeedFactor25,
+    SpeedFactor50,
+    SpeedFactor75,
+    SpeedFactor100,
+    SpeedFactor125,
+    SpeedFactor150,
+    SpeedFactor175,
+    SpeedFactor200,
+    SpeedFactor225,
+    SpeedFactor250,
+    SpeedFactor275,
+    SpeedFactor300,
+    SaveState,
+    LoadState,
+    GSButton,
+    SaveStateSlot0,
+    SaveStateSlot1,
+    SaveStateSlot2,
+    SaveStateSlot3,
+    SaveStateSlot4,
+    SaveStateSlot5,
+    SaveStateSlot6,
+    SaveStateSlot7,
+    SaveStateSlot8,
+    SaveStateSlot9,
+    Fullscreen,
+
+    Count
+};
+
+static_assert((int)Hotkey::Count <= INPUT_MAPPING_TABLE_MAX_HOTKEYS, "too many hotkeys for the mapping table");
+
 struct InputMapping
 {
     std::vector<std::string> Name;
@@ -72,7 +124,10 @@ struct InputProfile
     // input device information
     std::string DeviceName;
     int DeviceNum = -1;
-    std::chrono::time_point<std::chrono::high_resolution_clock> LastDeviceCheckTime = std::chrono::high_resolution_clock::now();
+
+    // raw HID information
+    bool UseRawHid = false;
+    bool MeasureHidLatency = false;
 
     // Gameboy information
     std::string GameboyRom;
@@ -81,6 +136,9 @@ struct InputProfile
     // input device
     Utilities::InputDevice InputDevice;
 
+    // rumble thread (applies rumble off the emulation thread)
+    Thread::RumbleThread* RumbleThread = nullptr;
+
     // buttons
     InputMapping Button_A;
     InputMapping Button_B;
@@ -103,22 +161,17 @@ struct InputProfile
     InputMapping AnalogStick_Left;
     InputMapping AnalogStick_Right;
 
+    // buttons & analog stick compiled for GetKeys
+    Utilities::InputMappingTable MappingTable;
+
     // hotkeys
-    bool Hotkey_Shutdown_Pressed = false;
     InputMapping Hotkey_Shutdown;
-    bool Hotkey_Exit_Pressed = false;
     InputMapping Hotkey_Exit;
-    bool Hotkey_SoftReset_Pressed = false;
     InputMapping Hotkey_SoftReset;
-    bool Hotkey_HardReset_Pressed = false;
     InputMapping Hotkey_HardReset;
-    bool Hotkey_Resume_Pressed = false;
     InputMapping Hotkey_Resume;
-    bool Hotkey_Screenshot_Pressed = false;
     InputMapping Hotkey_Screenshot;
-    bool Hotkey_LimitFPS_Pressed = false;
     InputMapping Hotkey_LimitFPS;
-    bool Hotkey_SpeedFactor_Pressed = false;
     InputMapping Hotkey_SpeedFactor25;
     InputMapping Hotkey_SpeedFactor50;
     InputMapping Hotkey_SpeedFactor75;
@@ -131,13 +184,9 @@ struct InputProfile
     InputMapping Hotkey_SpeedFactor250;
     InputMapping Hotkey_SpeedFactor275;
     InputMapping Hotkey_SpeedFactor300;
-    bool Hotkey_SaveState_Pressed = false;
     InputMapping Hotkey_SaveState;
-    bool Hotkey_LoadState_Pressed = false;
     InputMapping Hotkey_LoadState;
-    bool Hotkey_GSButton_Pressed = false;
     InputMapping Hotkey_GSButton;
-    bool Hotkey_SaveStateSlot_Pressed = false;
     InputMapping Hotkey_SaveStateSlot0;
     InputMapping Hotkey_SaveStateSlot1;
     InputMapping Hotkey_SaveStateSlot2;
@@ -148,8 +197,12 @@ struct InputProfile
     InputMapping Hotkey_SaveStateSlot7;
     InputMapping Hotkey_SaveStateSlot8;
     InputMapping Hotkey_SaveStateSlot9;
-    bool Hotkey_Fullscreen_Pressed = false;
     InputMapping Hotkey_Fullscreen;
+    // bitmask of the hotkeys which were
+    // pressed during the previous check,
+    // checked by both the hotkeys thread
+    // and the emulation thread
+    std::atomic<uint64_t> HotkeysPressed = 0;
 };
 
 //
@@ -162,6 +215,12 @@ static Thread::SDLThread *l_SDLThread = nullptr;
 // Hotkeys thread (for when paused)
 static Thread::HotkeysThread *l_HotkeysThread = nullptr;
 
+// Input thread (polls input devices)
+static Thread::InputThread *l_InputThread = nullptr;
+
+// Hotkey action thread (runs the actions of hotkeys)
+static Thread::HotkeyActionThread *l_HotkeyActionThread = nullptr;
+
 // input profiles
 static InputProfile l_InputProfiles[NUM_CONTROLLERS];
 
@@ -174,18 +233,49 @@ static CONTROL_INFO l_ControlInfo;
 // keyboard state
 static bool l_KeyboardState[SDL_NUM_SCANCODES];
 
+// steady clock time in nanoseconds of the last key event
+static std::atomic<uint64_t> l_KeyboardChangeTimestamp = 0;
+
+// steady clock time in nanoseconds of the newest
+// input event which has been published to the metrics
+static uint64_t l_PolledEventTime = 0;
+
+// time spent in ControllerCommand per frame
+static Utilities::FrameTimeStatistics l_ControllerCommandStatistics("RMG-Input: ControllerCommand");
+
+// amount of frames rendered by the core when ControllerCommand
+// was last called, used to detect the start of a new frame,
+// the PIF can send multiple commands to the same
+// controller per frame, so the controller order can't be used
+static uint64_t l_LastCommandFrame = 0;
+static bool     l_HasCommandFrame  = false;
+
+// input movie (records or plays back GetKeys)
+static Utilities::InputMovie l_InputMovie;
+
+#ifdef HIDAPI
+// age of the HID reports read by GetKeys
+static Utilities::FrameTimeStatistics l_HidLatencyStatistics[NUM_CONTROLLERS] =
+{
+    {"RMG-Input: HID report age (controller 1)"},
+    {"RMG-Input: HID report age (controller 2)"},
+    {"RMG-Input: HID report age (controller 3)"},
+    {"RMG-Input: HID report age (controller 4)"},
+};
+#endif // HIDAPI
+
 //
 // Local Functions
 //
 
-static void load_inputmapping_settings(InputMapping* mapping, std::string section,
+static void load_inputmapping_settings(InputMapping* mapping, Utilities::InputProfileBlob& blob,
     SettingsID inputNameSettingsId, SettingsID inputTypeSettingsId, 
     SettingsID dataSettingsId, SettingsID extraDataSettingsId)
 {
-    mapping->Name = CoreSettingsGetStringListValue(inputNameSettingsId, section);
-    mapping->Type = CoreSettingsGetIntListValue(inputTypeSettingsId, section);
-    mapping->Data = CoreSettingsGetIntListValue(dataSettingsId, section);
-    mapping->ExtraData = CoreSettingsGetIntListValue(extraDataSettingsId, section);
+    mapping->Name = blob.GetStringListValue(inputNameSettingsId);
+    mapping->Type = blob.GetIntListValue(inputTypeSettingsId);
+    mapping->Data = blob.GetIntListValue(dataSettingsId);
+    mapping->ExtraData = blob.GetIntListValue(extraDataSettingsId);
     mapping->Count = std::min(mapping->Type.size(), std::min(mapping->Data.size(), mapping->ExtraData.size()));
 
     // check if mapping is old profile type,
@@ -195,13 +285,199 @@ static void load_inputmapping_settings(InputMapping* mapping, std::string sectio
         !mapping->Name.empty() && !mapping->Name.at(0).empty() &&
         mapping->Name.at(0).find_first_not_of(' ') != std::string::npos)
     {
-        mapping->Type.push_back(CoreSettingsGetIntValue(inputTypeSettingsId, section));
-        mapping->Data.push_back(CoreSettingsGetIntValue(dataSettingsId, section));
-        mapping->ExtraData.push_back(CoreSettingsGetIntValue(extraDataSettingsId, section));
+        mapping->Type.push_back(blob.GetIntValue(inputTypeSettingsId));
+        mapping->Data.push_back(blob.GetIntValue(dataSettingsId));
+        mapping->ExtraData.push_back(blob.GetIntValue(extraDataSettingsId));
         mapping->Count = 1;
     }
 }
 
+static void compile_mapping_table(InputProfile* profile)
+{
+    Utilities::InputMappingTable* table = &profile->MappingTable;
+    bool ret = true;
+
+#define ADD_BUTTON_MAPPING(button, mapping) \
+    ret &= table->AddButtonMapping(button, profile->mapping.Type, profile->mapping.Data, profile->mapping.ExtraData, profile->mapping.Count)
+#define ADD_AXIS_MAPPING(direction, mapping) \
+    ret &= table->AddAxisMapping(direction, profile->mapping.Type, profile->mapping.Data, profile->mapping.ExtraData, profile->mapping.Count)
+#define ADD_HOTKEY_MAPPING(hotkey) \
+    ret &= table->AddHotkeyMapping((int)Hotkey::hotkey, profile->Hotkey_##hotkey.Type, profile->Hotkey_##hotkey.Data, profile->Hotkey_##hotkey.ExtraData, profile->Hotkey_##hotkey.Count)
+
+    table->Clear();
+
+    ADD_BUTTON_MAPPING(N64ControllerButton::A,            Button_A);
+    ADD_BUTTON_MAPPING(N64ControllerButton::B,            Button_B);
+    ADD_BUTTON_MAPPING(N64ControllerButton::Start,        Button_Start);
+    ADD_BUTTON_MAPPING(N64ControllerButton::DpadUp,       Button_DpadUp);
+    ADD_BUTTON_MAPPING(N64ControllerButton::DpadDown,     Button_DpadDown);
+    ADD_BUTTON_MAPPING(N64ControllerButton::DpadLeft,     Button_DpadLeft);
+    ADD_BUTTON_MAPPING(N64ControllerButton::DpadRight,    Button_DpadRight);
+    ADD_BUTTON_MAPPING(N64ControllerButton::CButtonUp,    Button_CButtonUp);
+    ADD_BUTTON_MAPPING(N64ControllerButton::CButtonDown,  Button_CButtonDown);
+    ADD_BUTTON_MAPPING(N64ControllerButton::CButtonLeft,  Button_CButtonLeft);
+    ADD_BUTTON_MAPPING(N64ControllerButton::CButtonRight, Button_CButtonRight);
+    ADD_BUTTON_MAPPING(N64ControllerButton::LeftTrigger,  Button_LeftTrigger);
+    ADD_BUTTON_MAPPING(N64ControllerButton::RightTrigger, Button_RightTrigger);
+    ADD_BUTTON_MAPPING(N64ControllerButton::ZTrigger,     Button_ZTrigger);
+
+    ADD_AXIS_MAPPING(InputAxisDirection::Up,    AnalogStick_Up);
+    ADD_AXIS_MAPPING(InputAxisDirection::Down,  AnalogStick_Down);
+    ADD_AXIS_MAPPING(InputAxisDirection::Left,  AnalogStick_Left);
+    ADD_AXIS_MAPPING(InputAxisDirection::Right, AnalogStick_Right);
+
+    ADD_HOTKEY_MAPPING(Shutdown);
+    ADD_HOTKEY_MAPPING(Exit);
+    ADD_HOTKEY_MAPPING(SoftReset);
+    ADD_HOTKEY_MAPPING(Resume);
+    ADD_HOTKEY_MAPPING(Screenshot);
+    ADD_HOTKEY_MAPPING(LimitFPS);
+    ADD_HOTKEY_MAPPING(SpeedFactor25);
+    ADD_HOTKEY_MAPPING(SpeedFactor50);
+    ADD_HOTKEY_MAPPING(SpeedFactor75);
+    ADD_HOTKEY_MAPPING(SpeedFactor100);
+    ADD_HOTKEY_MAPPING(SpeedFactor125);
+    ADD_HOTKEY_MAPPING(SpeedFactor150);
+    ADD_HOTKEY_MAPPING(SpeedFactor175);
+    ADD_HOTKEY_MAPPING(SpeedFactor200);
+    ADD_HOTKEY_MAPPING(SpeedFactor225);
+    ADD_HOTKEY_MAPPING(SpeedFactor250);
+    ADD_HOTKEY_MAPPING(SpeedFactor275);
+    ADD_HOTKEY_MAPPING(SpeedFactor300);
+    ADD_HOTKEY_MAPPING(SaveState);
+    ADD_HOTKEY_MAPPING(LoadState);
+    ADD_HOTKEY_MAPPING(GSButton);
+    ADD_HOTKEY_MAPPING(SaveStateSlot0);
+    ADD_HOTKEY_MAPPING(SaveStateSlot1);
+    ADD_HOTKEY_MAPPING(SaveStateSlot2);
+    ADD_HOTKEY_MAPPING(SaveStateSlot3);
+    ADD_HOTKEY_MAPPING(SaveStateSlot4);
+    ADD_HOTKEY_MAPPING(SaveStateSlot5);
+    ADD_HOTKEY_MAPPING(SaveStateSlot6);
+    ADD_HOTKEY_MAPPING(SaveStateSlot7);
+    ADD_HOTKEY_MAPPING(SaveStateSlot8);
+    ADD_HOTKEY_MAPPING(SaveStateSlot9);
+    ADD_HOTKEY_MAPPING(Fullscreen);
+
+#undef ADD_BUTTON_MAPPING
+#undef ADD_AXIS_MAPPING
+#undef ADD_HOTKEY_MAPPING
+
+    table->SetAnalogStickResponse(profile->DeadzoneValue, profile->SensitivityValue);
+
+    // the hotkeys may have changed,
+    // so don't detect any releases
+    profile->HotkeysPressed = 0;
+
+    if (!ret)
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning, "RMG-Input: too many mappings, some of them will be ignored");
+    }
+}
+
+// reads the settings of the profile section, from its
+// compiled blob when it's valid, else from the settings,
+// which compiles a new blob
+static void load_profile_settings(InputProfile* profile, const std::string& section)
+{
+    Utilities::InputProfileBlob blob;
+    blob.Load(section);
+
+    profile->PluggedIn = blob.GetBoolValue(SettingsID::Input_PluggedIn);
+    profile->DeadzoneValue = blob.GetIntValue(SettingsID::Input_Deadzone);
+    profile->ControllerPak = (N64ControllerPak)blob.GetIntValue(SettingsID::Input_Pak);
+    profile->DeviceName = blob.GetStringValue(SettingsID::Input_DeviceName);
+    profile->DeviceNum = blob.GetIntValue(SettingsID::Input_DeviceNum);
+    profile->GameboyRom = blob.GetStringValue(SettingsID::Input_GameboyRom);
+    profile->GameboySave = blob.GetStringValue(SettingsID::Input_GameboySave);
+    profile->UseRawHid = blob.GetBoolValue(SettingsID::Input_UseRawHid);
+    profile->MeasureHidLatency = blob.GetBoolValue(SettingsID::Input_MeasureHidLatency);
+
+    // keep compatibility with profiles before version v0.3.9
+    if (blob.KeyExists("Sensitivity"))
+    {
+        profile->SensitivityValue = blob.GetIntValue(SettingsID::Input_Sensitivity);
+    }
+    else
+    {
+        profile->SensitivityValue = 100;
+    }
+
+    // load inputmapping settings
+    load_inputmapping_settings(&profile->Button_A, blob, SettingsID::Input_A_Name, SettingsID::Input_A_InputType, SettingsID::Input_A_Data, SettingsID::Input_A_ExtraData);
+    load_inputmapping_settings(&profile->Button_B, blob, SettingsID::Input_B_Name, SettingsID::Input_B_InputType, SettingsID::Input_B_Data, SettingsID::Input_B_ExtraData);
+    load_inputmapping_settings(&profile->Button_Start, blob, SettingsID::Input_Start_Name, SettingsID::Input_Start_InputType, SettingsID::Input_Start_Data, SettingsID::Input_Start_ExtraData);
+    load_inputmapping_settings(&profile->Button_DpadUp, blob, SettingsID::Input_DpadUp_Name, SettingsID::Input_DpadUp_InputType, SettingsID::Input_DpadUp_Data, SettingsID::Input_DpadUp_ExtraData);
+    load_inputmapping_settings(&profile->Button_DpadDown, blob, SettingsID::Input_DpadDown_Name, SettingsID::Input_DpadDown_InputType, SettingsID::Input_DpadDown_Data, SettingsID::Input_DpadDown_ExtraData);
+    load_inputmapping_settings(&profile->Button_DpadLeft, blob, SettingsID::Input_DpadLeft_Name, SettingsID::Input_DpadLeft_InputType, SettingsID::Input_DpadLeft_Data, SettingsID::Input_DpadLeft_ExtraData);
+    load_inputmapping_settings(&profile->Button_DpadRight, blob, SettingsID::Input_DpadRight_Name, SettingsID::Input_DpadRight_InputType, SettingsID::Input_DpadRight_Data, SettingsID::Input_DpadRight_ExtraData);
+    load_inputmapping_settings(&profile->Button_CButtonUp, blob, SettingsID::Input_CButtonUp_Name, SettingsID::Input_CButtonUp_InputType, SettingsID::Input_CButtonUp_Data, SettingsID::Input_CButtonUp_ExtraData);
+    load_inputmapping_settings(&profile->Button_CButtonDown, blob, SettingsID::Input_CButtonDown_Name, SettingsID::Input_CButtonDown_InputType, SettingsID::Input_CButtonDown_Data, SettingsID::Input_CButtonDown_ExtraData);
+    load_inputmapping_settings(&profile->Button_CButtonLeft, blob, SettingsID::Input_CButtonLeft_Name, SettingsID::Input_CButtonLeft_InputType, SettingsID::Input_CButtonLeft_Data, SettingsID::Input_CButtonLeft_ExtraData);
+    load_inputmapping_settings(&profile->Button_CButtonRight, blob, SettingsID::Input_CButtonRight_Name, SettingsID::Input_CButtonRight_InputType, SettingsID::Input_CButtonRight_Data, SettingsID::Input_CButtonRight_ExtraData);
+    load_inputmapping_settings(&profile->Button_LeftTrigger, blob, SettingsID::Input_LeftTrigger_Name, SettingsID::Input_LeftTrigger_InputType, SettingsID::Input_LeftTrigger_Data, SettingsID::Input_LeftTrigger_ExtraData);
+    load_inputmapping_settings(&profile->Button_RightTrigger, blob, SettingsID::Input_RightTrigger_Name, SettingsID::Input_RightTrigger_InputType, SettingsID::Input_RightTrigger_Data, SettingsID::Input_RightTrigger_ExtraData);
+    load_inputmapping_settings(&profile->Button_ZTrigger, blob, SettingsID::Input_ZTrigger_Name, SettingsID::Input_ZTrigger_InputType, SettingsID::Input_ZTrigger_Data, SettingsID::Input_ZTrigger_ExtraData);
+    load_inputmapping_settings(&profile->AnalogStick_Up, blob, SettingsID::Input_AnalogStickUp_Name, SettingsID::Input_AnalogStickUp_InputType, SettingsID::Input_AnalogStickUp_Data, SettingsID::Input_AnalogStickUp_ExtraData);
+    load_inputmapping_settings(&profile->AnalogStick_Down, blob, SettingsID::Input_AnalogStickDown_Name, SettingsID::Input_AnalogStickDown_InputType, SettingsID::Input_AnalogStickDown_Data, SettingsID::Input_AnalogStickDown_ExtraData);
+    load_inputmapping_settings(&profile->AnalogStick_Left, blob, SettingsID::Input_AnalogStickLeft_Name, SettingsID::Input_AnalogStickLeft_InputType, SettingsID::Input_AnalogStickLeft_Data, SettingsID::Input_AnalogStickLeft_ExtraData);
+    load_inputmapping_settings(&profile->AnalogStick_Right, blob, SettingsID::Input_AnalogStickRight_Name, SettingsID::Input_AnalogStickRight_InputType, SettingsID::Input_AnalogStickRight_Data, SettingsID::Input_AnalogStickRight_ExtraData);
+
+    // load hotkeys settings
+    load_inputmapping_settings(&profile->Hotkey_Shutdown, blob, SettingsID::Input_Hotkey_Shutdown_Name, SettingsID::Input_Hotkey_Shutdown_InputType, SettingsID::Input_Hotkey_Shutdown_Data, SettingsID::Input_Hotkey_Shutdown_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_Exit, blob, SettingsID::Input_Hotkey_Exit_Name, SettingsID::Input_Hotkey_Exit_InputType, SettingsID::Input_Hotkey_Exit_Data, SettingsID::Input_Hotkey_Exit_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SoftReset, blob, SettingsID::Input_Hotkey_SoftReset_Name, SettingsID::Input_Hotkey_SoftReset_InputType, SettingsID::Input_Hotkey_SoftReset_Data, SettingsID::Input_Hotkey_SoftReset_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_HardReset, blob, SettingsID::Input_Hotkey_HardReset_Name, SettingsID::Input_Hotkey_HardReset_InputType, SettingsID::Input_Hotkey_HardReset_Data, SettingsID::Input_Hotkey_HardReset_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_Resume, blob, SettingsID::Input_Hotkey_Resume_Name, SettingsID::Input_Hotkey_Resume_InputType, SettingsID::Input_Hotkey_Resume_Data, SettingsID::Input_Hotkey_Resume_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_Screenshot, blob, SettingsID::Input_Hotkey_Screenshot_Name, SettingsID::Input_Hotkey_Screenshot_InputType, SettingsID::Input_Hotkey_Screenshot_Data, SettingsID::Input_Hotkey_Screenshot_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_LimitFPS, blob, SettingsID::Input_Hotkey_LimitFPS_Name, SettingsID::Input_Hotkey_LimitFPS_InputType, SettingsID::Input_Hotkey_LimitFPS_Data, SettingsID::Input_Hotkey_LimitFPS_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor25, blob, SettingsID::Input_Hotkey_SpeedFactor25_Name, SettingsID::Input_Hotkey_SpeedFactor25_InputType, SettingsID::Input_Hotkey_SpeedFactor25_Data, SettingsID::Input_Hotkey_SpeedFactor25_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor50, blob, SettingsID::Input_Hotkey_SpeedFactor50_Name, SettingsID::Input_Hotkey_SpeedFactor50_InputType, SettingsID::Input_Hotkey_SpeedFactor50_Data, SettingsID::Input_Hotkey_SpeedFactor50_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor75, blob, SettingsID::Input_Hotkey_SpeedFactor75_Name, SettingsID::Input_Hotkey_SpeedFactor75_InputType, SettingsID::Input_Hotkey_SpeedFactor75_Data, SettingsID::Input_Hotkey_SpeedFactor75_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor100, blob, SettingsID::Input_Hotkey_SpeedFactor100_Name, SettingsID::Input_Hotkey_SpeedFactor100_InputType, SettingsID::Input_Hotkey_SpeedFactor100_Data, SettingsID::Input_Hotkey_SpeedFactor100_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor125, blob, SettingsID::Input_Hotkey_SpeedFactor125_Name, SettingsID::Input_Hotkey_SpeedFactor125_InputType, SettingsID::Input_Hotkey_SpeedFactor125_Data, SettingsID::Input_Hotkey_SpeedFactor125_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor150, blob, SettingsID::Input_Hotkey_SpeedFactor150_Name, SettingsID::Input_Hotkey_SpeedFactor150_InputType, SettingsID::Input_Hotkey_SpeedFactor150_Data, SettingsID::Input_Hotkey_SpeedFactor150_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor175, blob, SettingsID::Input_Hotkey_SpeedFactor175_Name, SettingsID::Input_Hotkey_SpeedFactor175_InputType, SettingsID::Input_Hotkey_SpeedFactor175_Data, SettingsID::Input_Hotkey_SpeedFactor175_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor200, blob, SettingsID::Input_Hotkey_SpeedFactor200_Name, SettingsID::Input_Hotkey_SpeedFactor200_InputType, SettingsID::Input_Hotkey_SpeedFactor200_Data, SettingsID::Input_Hotkey_SpeedFactor200_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor225, blob, SettingsID::Input_Hotkey_SpeedFactor225_Name, SettingsID::Input_Hotkey_SpeedFactor225_InputType, SettingsID::Input_Hotkey_SpeedFactor225_Data, SettingsID::Input_Hotkey_SpeedFactor225_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor250, blob, SettingsID::Input_Hotkey_SpeedFactor250_Name, SettingsID::Input_Hotkey_SpeedFactor250_InputType, SettingsID::Input_Hotkey_SpeedFactor250_Data, SettingsID::Input_Hotkey_SpeedFactor250_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor275, blob, SettingsID::Input_Hotkey_SpeedFactor275_Name, SettingsID::Input_Hotkey_SpeedFactor275_InputType, SettingsID::Input_Hotkey_SpeedFactor275_Data, SettingsID::Input_Hotkey_SpeedFactor275_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SpeedFactor300, blob, SettingsID::Input_Hotkey_SpeedFactor300_Name, SettingsID::Input_Hotkey_SpeedFactor300_InputType, SettingsID::Input_Hotkey_SpeedFactor300_Data, SettingsID::Input_Hotkey_SpeedFactor300_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveState, blob, SettingsID::Input_Hotkey_SaveState_Name, SettingsID::Input_Hotkey_SaveState_InputType, SettingsID::Input_Hotkey_SaveState_Data, SettingsID::Input_Hotkey_SaveState_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_LoadState, blob, SettingsID::Input_Hotkey_LoadState_Name, SettingsID::Input_Hotkey_LoadState_InputType, SettingsID::Input_Hotkey_LoadState_Data, SettingsID::Input_Hotkey_LoadState_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_GSButton, blob, SettingsID::Input_Hotkey_GSButton_Name, SettingsID::Input_Hotkey_GSButton_InputType, SettingsID::Input_Hotkey_GSButton_Data, SettingsID::Input_Hotkey_GSButton_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot0, blob, SettingsID::Input_Hotkey_SaveStateSlot0_Name, SettingsID::Input_Hotkey_SaveStateSlot0_InputType, SettingsID::Input_Hotkey_SaveStateSlot0_Data, SettingsID::Input_Hotkey_SaveStateSlot0_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot1, blob, SettingsID::Input_Hotkey_SaveStateSlot1_Name, SettingsID::Input_Hotkey_SaveStateSlot1_InputType, SettingsID::Input_Hotkey_SaveStateSlot1_Data, SettingsID::Input_Hotkey_SaveStateSlot1_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot2, blob, SettingsID::Input_Hotkey_SaveStateSlot2_Name, SettingsID::Input_Hotkey_SaveStateSlot2_InputType, SettingsID::Input_Hotkey_SaveStateSlot2_Data, SettingsID::Input_Hotkey_SaveStateSlot2_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot3, blob, SettingsID::Input_Hotkey_SaveStateSlot3_Name, SettingsID::Input_Hotkey_SaveStateSlot3_InputType, SettingsID::Input_Hotkey_SaveStateSlot3_Data, SettingsID::Input_Hotkey_SaveStateSlot3_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot4, blob, SettingsID::Input_Hotkey_SaveStateSlot4_Name, SettingsID::Input_Hotkey_SaveStateSlot4_InputType, SettingsID::Input_Hotkey_SaveStateSlot4_Data, SettingsID::Input_Hotkey_SaveStateSlot4_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot5, blob, SettingsID::Input_Hotkey_SaveStateSlot5_Name, SettingsID::Input_Hotkey_SaveStateSlot5_InputType, SettingsID::Input_Hotkey_SaveStateSlot5_Data, SettingsID::Input_Hotkey_SaveStateSlot5_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot6, blob, SettingsID::Input_Hotkey_SaveStateSlot6_Name, SettingsID::Input_Hotkey_SaveStateSlot6_InputType, SettingsID::Input_Hotkey_SaveStateSlot6_Data, SettingsID::Input_Hotkey_SaveStateSlot6_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot7, blob, SettingsID::Input_Hotkey_SaveStateSlot7_Name, SettingsID::Input_Hotkey_SaveStateSlot7_InputType, SettingsID::Input_Hotkey_SaveStateSlot7_Data, SettingsID::Input_Hotkey_SaveStateSlot7_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot8, blob, SettingsID::Input_Hotkey_SaveStateSlot8_Name, SettingsID::Input_Hotkey_SaveStateSlot8_InputType, SettingsID::Input_Hotkey_SaveStateSlot8_Data, SettingsID::Input_Hotkey_SaveStateSlot8_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_SaveStateSlot9, blob, SettingsID::Input_Hotkey_SaveStateSlot9_Name, SettingsID::Input_Hotkey_SaveStateSlot9_InputType, SettingsID::Input_Hotkey_SaveStateSlot9_Data, SettingsID::Input_Hotkey_SaveStateSlot9_ExtraData);
+    load_inputmapping_settings(&profile->Hotkey_Fullscreen, blob, SettingsID::Input_Hotkey_Fullscreen_Name, SettingsID::Input_Hotkey_Fullscreen_InputType, SettingsID::Input_Hotkey_Fullscreen_Data, SettingsID::Input_Hotkey_Fullscreen_ExtraData);
+
+    if (blob.IsRecording())
+    {
+        blob.Save();
+    }
+}
+
+// compiles the blob of a section which
+// has been saved by the input dialog
+static void compile_profile_blob(const std::string& section)
+{
+    InputProfile profile;
+
+    if (!CoreSettingsSectionExists(section))
+    {
+        return;
+    }
+
+    load_profile_settings(&profile, section);
+}
+
 static void load_settings(void)
 {
     std::string gameId;
@@ -272,78 +548,9 @@ static void load_settings(void)
             continue;
         }
 
-        profile->PluggedIn = CoreSettingsGetBoolValue(SettingsID::Input_PluggedIn, section);
-        profile->DeadzoneValue = CoreSettingsGetIntValue(SettingsID::Input_Deadzone, section);
-        profile->ControllerPak = (N64ControllerPak)CoreSettingsGetIntValue(SettingsID::Input_Pak, section);
-        profile->DeviceName = CoreSettingsGetStringValue(SettingsID::Input_DeviceName, section);
-        profile->DeviceNum = CoreSettingsGetIntValue(SettingsID::Input_DeviceNum, section);
-        profile->GameboyRom = CoreSettingsGetStringValue(SettingsID::Input_GameboyRom, section);
-        profile->GameboySave = CoreSettingsGetStringValue(SettingsID::Input_GameboySave, section);
-
-        // keep compatibility with profiles before version v0.3.9
-        if (CoreSettingsKeyExists(section, "Sensitivity"))
-        {
-            profile->SensitivityValue = CoreSettingsGetIntValue(SettingsID::Input_Sensitivity, section);
-        }
-        else
-        {
-            profile->SensitivityValue = 100;
-        }
+        load_profile_settings(profile, section);
 
-        // load inputmapping settings
-        load_inputmapping_settings(&profile->Button_A, section, SettingsID::Input_A_Name, SettingsID::Input_A_InputType, SettingsID::Input_A_Data, SettingsID::Input_A_ExtraData);
-        load_inputmapping_settings(&profile->Button_B, section, SettingsID::Input_B_Name, SettingsID::Input_B_InputType, SettingsID::Input_B_Data, SettingsID::Input_B_ExtraData);
-        load_inputmapping_settings(&profile->Button_Start, section, SettingsID::Input_Start_Name, SettingsID::Input_Start_InputType, SettingsID::Input_Start_Data, SettingsID::Input_Start_ExtraData);
-        load_inputmapping_settings(&profile->Button_DpadUp, section, SettingsID::Input_DpadUp_Name, SettingsID::Input_DpadUp_InputType, SettingsID::Input_DpadUp_Data, SettingsID::Input_DpadUp_ExtraData);
-        load_inputmapping_settings(&profile->Button_DpadDown, section, SettingsID::Input_DpadDown_Name, SettingsID::Input_DpadDown_InputType, SettingsID::Input_DpadDown_Data, SettingsID::Input_DpadDown_ExtraData);
-        load_inputmapping_settings(&profile->Button_DpadLeft, section, SettingsID::Input_DpadLeft_Name, SettingsID::Input_DpadLeft_InputType, SettingsID::Input_DpadLeft_Data, SettingsID::Input_DpadLeft_ExtraData);
-        load_inputmapping_settings(&profile->Button_DpadRight, section, SettingsID::Input_DpadRight_Name, SettingsID::Input_DpadRight_InputType, SettingsID::Input_DpadRight_Data, SettingsID::Input_DpadRight_ExtraData);
-        load_inputmapping_settings(&profile->Button_CButtonUp, section, SettingsID::Input_CButtonUp_Name, SettingsID::Input_CButtonUp_InputType, SettingsID::Input_CButtonUp_Data, SettingsID::Input_CButtonUp_ExtraData);
-        load_inputmapping_settings(&profile->Button_CButtonDown, section, SettingsID::Input_CButtonDown_Name, SettingsID::Input_CButtonDown_InputType, SettingsID::Input_CButtonDown_Data, SettingsID::Input_CButtonDown_ExtraData);
-        load_inputmapping_settings(&profile->Button_CButtonLeft, section, SettingsID::Input_CButtonLeft_Name, SettingsID::Input_CButtonLeft_InputType, SettingsID::Input_CButtonLeft_Data, SettingsID::Input_CButtonLeft_ExtraData);
-        load_inputmapping_settings(&profile->Button_CButtonRight, section, SettingsID::Input_CButtonRight_Name, SettingsID::Input_CButtonRight_InputType, SettingsID::Input_CButtonRight_Data, SettingsID::Input_CButtonRight_ExtraData);
-        load_inputmapping_settings(&profile->Button_LeftTrigger, section, SettingsID::Input_LeftTrigger_Name, SettingsID::Input_LeftTrigger_InputType, SettingsID::Input_LeftTrigger_Data, SettingsID::Input_LeftTrigger_ExtraData);
-        load_inputmapping_settings(&profile->Button_RightTrigger, section, SettingsID::Input_RightTrigger_Name, SettingsID::Input_RightTrigger_InputType, SettingsID::Input_RightTrigger_Data, SettingsID::Input_RightTrigger_ExtraData);
-        load_inputmapping_settings(&profile->Button_ZTrigger, section, SettingsID::Input_ZTrigger_Name, SettingsID::Input_ZTrigger_InputType, SettingsID::Input_ZTrigger_Data, SettingsID::Input_ZTrigger_ExtraData);
-        load_inputmapping_settings(&profile->AnalogStick_Up, section, SettingsID::Input_AnalogStickUp_Name, SettingsID::Input_AnalogStickUp_InputType, SettingsID::Input_AnalogStickUp_Data, SettingsID::Input_AnalogStickUp_ExtraData);
-        load_inputmapping_settings(&profile->AnalogStick_Down, section, SettingsID::Input_AnalogStickDown_Name, SettingsID::Input_AnalogStickDown_InputType, SettingsID::Input_AnalogStickDown_Data, SettingsID::Input_AnalogStickDown_ExtraData);
-        load_inputmapping_settings(&profile->AnalogStick_Left, section, SettingsID::Input_AnalogStickLeft_Name, SettingsID::Input_AnalogStickLeft_InputType, SettingsID::Input_AnalogStickLeft_Data, SettingsID::Input_AnalogStickLeft_ExtraData);
-        load_inputmapping_settings(&profile->AnalogStick_Right, section, SettingsID::Input_AnalogStickRight_Name, SettingsID::Input_AnalogStickRight_InputType, SettingsID::Input_AnalogStickRight_Data, SettingsID::Input_AnalogStickRight_ExtraData);
-
-        // load hotkeys settings
-        load_inputmapping_settings(&profile->Hotkey_Shutdown, section, SettingsID::Input_Hotkey_Shutdown_Name, SettingsID::Input_Hotkey_Shutdown_InputType, SettingsID::Input_Hotkey_Shutdown_Data, SettingsID::Input_Hotkey_Shutdown_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_Exit, section, SettingsID::Input_Hotkey_Exit_Name, SettingsID::Input_Hotkey_Exit_InputType, SettingsID::Input_Hotkey_Exit_Data, SettingsID::Input_Hotkey_Exit_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SoftReset, section, SettingsID::Input_Hotkey_SoftReset_Name, SettingsID::Input_Hotkey_SoftReset_InputType, SettingsID::Input_Hotkey_SoftReset_Data, SettingsID::Input_Hotkey_SoftReset_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_HardReset, section, SettingsID::Input_Hotkey_HardReset_Name, SettingsID::Input_Hotkey_HardReset_InputType, SettingsID::Input_Hotkey_HardReset_Data, SettingsID::Input_Hotkey_HardReset_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_Resume, section, SettingsID::Input_Hotkey_Resume_Name, SettingsID::Input_Hotkey_Resume_InputType, SettingsID::Input_Hotkey_Resume_Data, SettingsID::Input_Hotkey_Resume_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_Screenshot, section, SettingsID::Input_Hotkey_Screenshot_Name, SettingsID::Input_Hotkey_Screenshot_InputType, SettingsID::Input_Hotkey_Screenshot_Data, SettingsID::Input_Hotkey_Screenshot_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_LimitFPS, section, SettingsID::Input_Hotkey_LimitFPS_Name, SettingsID::Input_Hotkey_LimitFPS_InputType, SettingsID::Input_Hotkey_LimitFPS_Data, SettingsID::Input_Hotkey_LimitFPS_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor25, section, SettingsID::Input_Hotkey_SpeedFactor25_Name, SettingsID::Input_Hotkey_SpeedFactor25_InputType, SettingsID::Input_Hotkey_SpeedFactor25_Data, SettingsID::Input_Hotkey_SpeedFactor25_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor50, section, SettingsID::Input_Hotkey_SpeedFactor50_Name, SettingsID::Input_Hotkey_SpeedFactor50_InputType, SettingsID::Input_Hotkey_SpeedFactor50_Data, SettingsID::Input_Hotkey_SpeedFactor50_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor75, section, SettingsID::Input_Hotkey_SpeedFactor75_Name, SettingsID::Input_Hotkey_SpeedFactor75_InputType, SettingsID::Input_Hotkey_SpeedFactor75_Data, SettingsID::Input_Hotkey_SpeedFactor75_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor100, section, SettingsID::Input_Hotkey_SpeedFactor100_Name, SettingsID::Input_Hotkey_SpeedFactor100_InputType, SettingsID::Input_Hotkey_SpeedFactor100_Data, SettingsID::Input_Hotkey_SpeedFactor100_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor125, section, SettingsID::Input_Hotkey_SpeedFactor125_Name, SettingsID::Input_Hotkey_SpeedFactor125_InputType, SettingsID::Input_Hotkey_SpeedFactor125_Data, SettingsID::Input_Hotkey_SpeedFactor125_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor150, section, SettingsID::Input_Hotkey_SpeedFactor150_Name, SettingsID::Input_Hotkey_SpeedFactor150_InputType, SettingsID::Input_Hotkey_SpeedFactor150_Data, SettingsID::Input_Hotkey_SpeedFactor150_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor175, section, SettingsID::Input_Hotkey_SpeedFactor175_Name, SettingsID::Input_Hotkey_SpeedFactor175_InputType, SettingsID::Input_Hotkey_SpeedFactor175_Data, SettingsID::Input_Hotkey_SpeedFactor175_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor200, section, SettingsID::Input_Hotkey_SpeedFactor200_Name, SettingsID::Input_Hotkey_SpeedFactor200_InputType, SettingsID::Input_Hotkey_SpeedFactor200_Data, SettingsID::Input_Hotkey_SpeedFactor200_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor225, section, SettingsID::Input_Hotkey_SpeedFactor225_Name, SettingsID::Input_Hotkey_SpeedFactor225_InputType, SettingsID::Input_Hotkey_SpeedFactor225_Data, SettingsID::Input_Hotkey_SpeedFactor225_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor250, section, SettingsID::Input_Hotkey_SpeedFactor250_Name, SettingsID::Input_Hotkey_SpeedFactor250_InputType, SettingsID::Input_Hotkey_SpeedFactor250_Data, SettingsID::Input_Hotkey_SpeedFactor250_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor275, section, SettingsID::Input_Hotkey_SpeedFactor275_Name, SettingsID::Input_Hotkey_SpeedFactor275_InputType, SettingsID::Input_Hotkey_SpeedFactor275_Data, SettingsID::Input_Hotkey_SpeedFactor275_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SpeedFactor300, section, SettingsID::Input_Hotkey_SpeedFactor300_Name, SettingsID::Input_Hotkey_SpeedFactor300_InputType, SettingsID::Input_Hotkey_SpeedFactor300_Data, SettingsID::Input_Hotkey_SpeedFactor300_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveState, section, SettingsID::Input_Hotkey_SaveState_Name, SettingsID::Input_Hotkey_SaveState_InputType, SettingsID::Input_Hotkey_SaveState_Data, SettingsID::Input_Hotkey_SaveState_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_LoadState, section, SettingsID::Input_Hotkey_LoadState_Name, SettingsID::Input_Hotkey_LoadState_InputType, SettingsID::Input_Hotkey_LoadState_Data, SettingsID::Input_Hotkey_LoadState_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_GSButton, section, SettingsID::Input_Hotkey_GSButton_Name, SettingsID::Input_Hotkey_GSButton_InputType, SettingsID::Input_Hotkey_GSButton_Data, SettingsID::Input_Hotkey_GSButton_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot0, section, SettingsID::Input_Hotkey_SaveStateSlot0_Name, SettingsID::Input_Hotkey_SaveStateSlot0_InputType, SettingsID::Input_Hotkey_SaveStateSlot0_Data, SettingsID::Input_Hotkey_SaveStateSlot0_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot1, section, SettingsID::Input_Hotkey_SaveStateSlot1_Name, SettingsID::Input_Hotkey_SaveStateSlot1_InputType, SettingsID::Input_Hotkey_SaveStateSlot1_Data, SettingsID::Input_Hotkey_SaveStateSlot1_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot2, section, SettingsID::Input_Hotkey_SaveStateSlot2_Name, SettingsID::Input_Hotkey_SaveStateSlot2_InputType, SettingsID::Input_Hotkey_SaveStateSlot2_Data, SettingsID::Input_Hotkey_SaveStateSlot2_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot3, section, SettingsID::Input_Hotkey_SaveStateSlot3_Name, SettingsID::Input_Hotkey_SaveStateSlot3_InputType, SettingsID::Input_Hotkey_SaveStateSlot3_Data, SettingsID::Input_Hotkey_SaveStateSlot3_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot4, section, SettingsID::Input_Hotkey_SaveStateSlot4_Name, SettingsID::Input_Hotkey_SaveStateSlot4_InputType, SettingsID::Input_Hotkey_SaveStateSlot4_Data, SettingsID::Input_Hotkey_SaveStateSlot4_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot5, section, SettingsID::Input_Hotkey_SaveStateSlot5_Name, SettingsID::Input_Hotkey_SaveStateSlot5_InputType, SettingsID::Input_Hotkey_SaveStateSlot5_Data, SettingsID::Input_Hotkey_SaveStateSlot5_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot6, section, SettingsID::Input_Hotkey_SaveStateSlot6_Name, SettingsID::Input_Hotkey_SaveStateSlot6_InputType, SettingsID::Input_Hotkey_SaveStateSlot6_Data, SettingsID::Input_Hotkey_SaveStateSlot6_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot7, section, SettingsID::Input_Hotkey_SaveStateSlot7_Name, SettingsID::Input_Hotkey_SaveStateSlot7_InputType, SettingsID::Input_Hotkey_SaveStateSlot7_Data, SettingsID::Input_Hotkey_SaveStateSlot7_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot8, section, SettingsID::Input_Hotkey_SaveStateSlot8_Name, SettingsID::Input_Hotkey_SaveStateSlot8_InputType, SettingsID::Input_Hotkey_SaveStateSlot8_Data, SettingsID::Input_Hotkey_SaveStateSlot8_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_SaveStateSlot9, section, SettingsID::Input_Hotkey_SaveStateSlot9_Name, SettingsID::Input_Hotkey_SaveStateSlot9_InputType, SettingsID::Input_Hotkey_SaveStateSlot9_Data, SettingsID::Input_Hotkey_SaveStateSlot9_ExtraData);
-        load_inputmapping_settings(&profile->Hotkey_Fullscreen, section, SettingsID::Input_Hotkey_Fullscreen_Name, SettingsID::Input_Hotkey_Fullscreen_InputType, SettingsID::Input_Hotkey_Fullscreen_Data, SettingsID::Input_Hotkey_Fullscreen_ExtraData);
+        compile_mapping_table(profile);
     }
 }
 
@@ -379,9 +586,11 @@ static void apply_controller_profiles(void)
         }
 
 #ifdef VRU
-        // attempt to try initializing VRU when needed,
-        // if it fails, unplug the VRU
-        if (emulateVRU && !IsVRUInit() && !InitVRU())
+        // attempt to try opening VRU when needed,
+        // if it fails, unplug the VRU, the model
+        // might still fail to load afterwards,
+        // ReadVRUResults reports an error then
+        if (emulateVRU && !OpenVRU())
         {
             profile->PluggedIn = false;
         }
@@ -440,40 +649,23 @@ static void setup_device_automatic(int num, InputProfile* profile)
         previousSdlDeviceNum = -1;
     }
 
-    bool foundSdlDevice                   = false;
-    SDL_GameController* sdlGameController = nullptr;
-    SDL_Joystick* sdlJoystick             = nullptr;
-    std::string sdlDeviceName;
+    bool foundSdlDevice = false;
 
-    for (int i = (previousSdlDeviceNum + 1); i < SDL_NumJoysticks(); i++)
+    // wait until SDLThread has enumerated the devices
+    while (!l_SDLThread->HasCachedInputDevices())
     {
-        if (SDL_IsGameController(i))
-        {
-            sdlGameController = SDL_GameControllerOpen(i);
-            if (sdlGameController != nullptr)
-            {
-                sdlDeviceName = SDL_GameControllerName(sdlGameController);
-                SDL_GameControllerClose(sdlGameController);
-                profile->DeviceNum   = i;
-                profile->DeviceName  = sdlDeviceName;
-                previousSdlDeviceNum = i;
-                foundSdlDevice       = true; 
-                break;
-            }
-        }
-        else
+        QThread::msleep(5);
+    }
+
+    for (const SDLDevice& device : l_SDLThread->GetCachedInputDevices())
+    {
+        if (device.Number > previousSdlDeviceNum)
         {
-            sdlJoystick = SDL_JoystickOpen(i);
-            if (sdlJoystick != nullptr)
-            {
-                sdlDeviceName = SDL_JoystickName(sdlJoystick);
-                SDL_JoystickClose(sdlJoystick);
-                profile->DeviceNum   = i;
-                profile->DeviceName  = sdlDeviceName;
-                previousSdlDeviceNum = i;
-                foundSdlDevice       = true; 
-                break;
-            }
+            profile->DeviceNum   = device.Number;
+            profile->DeviceName  = device.Name;
+            previousSdlDeviceNum = device.Number;
+            foundSdlDevice       = true;
+            break;
         }
     }
 
@@ -499,9 +691,6 @@ static void setup_device_automatic(int num, InputProfile* profile)
 
 static void open_controllers(void)
 {
-    // force re-fresh joystick list
-    SDL_JoystickUpdate();
-
     for (int i = 0; i < NUM_CONTROLLERS; i++)
     {
         InputProfile* profile = &l_InputProfiles[i];
@@ -515,11 +704,25 @@ static void open_controllers(void)
 
         if (profile->DeviceNum != (int)InputDeviceType::Keyboard)
         {
+            profile->InputDevice.SetUseRawHid(profile->UseRawHid);
             profile->InputDevice.OpenDevice(profile->DeviceName, profile->DeviceNum);
         }
     }
 }
 
+static void poll_controllers(void)
+{
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        InputProfile* profile = &l_InputProfiles[i];
+
+        if (profile->PluggedIn && profile->InputDevice.HasOpenDevice())
+        {
+            profile->InputDevice.UpdateState();
+        }
+    }
+}
+
 static void close_controllers(void)
 {
     for (int i = 0; i < NUM_CONTROLLERS; i++)
@@ -530,307 +733,261 @@ static void close_controllers(void)
     }
 }
 
-static int get_button_state(InputProfile* profile, const InputMapping* inputMapping, const bool allPressed = false)
+static unsigned char data_crc(unsigned char *data, int length)
 {
-    int state = 0;
+    unsigned char remainder = data[0];
+
+    int byte = 1;
+    unsigned char bit = 0;
 
-    for (int i = 0; i < inputMapping->Count; i++)
+    while (byte <= length)
     {
-        const int data = inputMapping->Data.at(i);
-        const int extraData = inputMapping->ExtraData.at(i);
+        int highBit = ((remainder & 0x80) != 0);
+        remainder = remainder << 1;
 
-        switch ((InputType)inputMapping->Type[i])
-        {
-            case InputType::GamepadButton:
-            {
-                if (allPressed && i > 0)
-                {
-                    state &= SDL_GameControllerGetButton(profile->InputDevice.GetGameControllerHandle(), (SDL_GameControllerButton)data);
-                }
-                else
-                {
-                    state |= SDL_GameControllerGetButton(profile->InputDevice.GetGameControllerHandle(), (SDL_GameControllerButton)data);
-                }
-            } break;
-            case InputType::GamepadAxis:
-            {
-                int axis_value = SDL_GameControllerGetAxis(profile->InputDevice.GetGameControllerHandle(), (SDL_GameControllerAxis)data);
-                if (allPressed && i > 0)
-                {
-                    state &= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
-                }
-                else
-                {
-                    state |= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
-                }
-            } break;
-            case InputType::JoystickButton:
-            {
-                if (allPressed && i > 0)
-                {
-                    state &= SDL_JoystickGetButton(profile->InputDevice.GetJoystickHandle(), data);
-                }
-                else
-                {
-                    state |= SDL_JoystickGetButton(profile->InputDevice.GetJoystickHandle(), data);
-                }
-            } break;
-            case InputType::JoystickAxis:
-            {
-                int axis_value = SDL_JoystickGetAxis(profile->InputDevice.GetJoystickHandle(), data);
-                if (allPressed && i > 0)
-                {
-                    state &= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
-                }
-                else
-                {
-                    state |= (abs(axis_value) >= (SDL_AXIS_PEAK / 2) && (extraData ? axis_value > 0 : axis_value < 0)) ? 1 : 0;
-                }
-            } break;
-            case InputType::Keyboard:
-            {
-                if (allPressed && i > 0)
-                {
-                    state &= l_KeyboardState[data] ? 1 : 0;
-                }
-                else
-                {
-                    state |= l_KeyboardState[data] ? 1 : 0;
-                }
-            } break;
-            default:
-                break;
-        }
+        remainder += (byte < length && data[byte] & (0x80 >> bit )) ? 1 : 0;
 
-        // early return when needed
-        if (allPressed && !state)
-        {
-            return state;
-        }
+        remainder ^= (highBit) ? 0x85 : 0;
+
+        bit++;
+        byte += bit/8;
+        bit %= 8;
     }
 
-    return state;
+    return remainder;
 }
 
-// returns axis input scaled to the range [-1, 1]
-static double get_axis_state(InputProfile* profile, const InputMapping* inputMapping, const int direction, const double value, bool& useButtonMapping)
+static void run_hotkey_action(int hotkey, bool pressed)
 {
-    double axis_state   = value;
-    bool   button_state = false;
-
-    for (int i = 0; i < inputMapping->Count; i++)
+    if (!pressed)
     {
-        const int data = inputMapping->Data.at(i);
-        const int extraData = inputMapping->ExtraData.at(i);
-
-        switch ((InputType)inputMapping->Type[i])
+        // only the gameshark button
+        // needs to know when it's released
+        if (hotkey == (int)Hotkey::GSButton)
         {
-            case InputType::GamepadButton:
-            {
-                button_state |= SDL_GameControllerGetButton(profile->InputDevice.GetGameControllerHandle(), (SDL_GameControllerButton)data);;
-            } break;
-            case InputType::GamepadAxis:
-            {
-                double axis_value = SDL_GameControllerGetAxis(profile->InputDevice.GetGameControllerHandle(), (SDL_GameControllerAxis)data);
-                if (extraData ? axis_value > 0 : axis_value < 0)
-                {
-                    axis_value = (axis_value / SDL_AXIS_PEAK);
-                    axis_value = abs(axis_value) * direction;
-                    axis_state = axis_value;
-                }
-            } break;
-            case InputType::JoystickButton:
-            {
-                button_state |= SDL_JoystickGetButton(profile->InputDevice.GetJoystickHandle(), data);;
-            } break;
-            case InputType::JoystickAxis:
-            {
-                double axis_value = SDL_JoystickGetAxis(profile->InputDevice.GetJoystickHandle(), data);
-                if (extraData ? axis_value > 0 : axis_value < 0)
-                {
-                    axis_value = (axis_value / SDL_AXIS_PEAK);
-                    axis_value = abs(axis_value) * direction;
-                    axis_state = axis_value;
-                }
-            } break;
-            case InputType::Keyboard:
-            {
-                button_state |= l_KeyboardState[data];
-            } break;
-            default:
-                break;
+            CorePressGamesharkButton(false);
         }
+        return;
     }
 
-    // when a button has been mapped
-    // to an axis, we should prioritize 
-    // the button when it's been pressed
-    if (button_state)
+    switch ((Hotkey)hotkey)
     {
-        useButtonMapping = true;
-        return direction;
+        case Hotkey::Shutdown:
+            CoreStopEmulation();
+            break;
+        case Hotkey::Exit:
+            QGuiApplication::quit();
+            break;
+        case Hotkey::SoftReset:
+            CoreResetEmulation(false);
+            break;
+        case Hotkey::Resume:
+            CoreIsEmulationPaused() ? CoreResumeEmulation() : CorePauseEmulation();
+            break;
+        case Hotkey::Screenshot:
+            CoreTakeScreenshot();
+            break;
+        case Hotkey::LimitFPS:
+            CoreSetSpeedLimiterState(!CoreIsSpeedLimiterEnabled());
+            break;
+        case Hotkey::SpeedFactor25:
+        case Hotkey::SpeedFactor50:
+        case Hotkey::SpeedFactor75:
+        case Hotkey::SpeedFactor100:
+        case Hotkey::SpeedFactor125:
+        case Hotkey::SpeedFactor150:
+        case Hotkey::SpeedFactor175:
+        case Hotkey::SpeedFactor200:
+        case Hotkey::SpeedFactor225:
+        case Hotkey::SpeedFactor250:
+        case Hotkey::SpeedFactor275:
+        case Hotkey::SpeedFactor300:
+            CoreSetSpeedFactor((hotkey - (int)Hotkey::SpeedFactor25 + 1) * 25);
+            break;
+        case Hotkey::SaveState:
+            CoreSaveState();
+            break;
+        case Hotkey::LoadState:
+            CoreLoadSaveState();
+            break;
+        case Hotkey::GSButton:
+            CorePressGamesharkButton(true);
+            break;
+        case Hotkey::SaveStateSlot0:
+        case Hotkey::SaveStateSlot1:
+        case Hotkey::SaveStateSlot2:
+        case Hotkey::SaveStateSlot3:
+        case Hotkey::SaveStateSlot4:
+        case Hotkey::SaveStateSlot5:
+        case Hotkey::SaveStateSlot6:
+        case Hotkey::SaveStateSlot7:
+        case Hotkey::SaveStateSlot8:
+        case Hotkey::SaveStateSlot9:
+            CoreSetSaveStateSlot(hotkey - (int)Hotkey::SaveStateSlot0);
+            break;
+        case Hotkey::Fullscreen:
+            CoreToggleFullscreen();
+            break;
+        default:
+            break;
     }
-    else if (!useButtonMapping)
+}
+
+static bool check_profile_hotkeys(InputProfile* profile, const Utilities::InputDeviceState& deviceState)
+{
+    // we only have to check for hotkeys
+    // when there's a controller opened
+    if (!profile->InputDevice.HasOpenDevice())
     {
-        return axis_state;
-    } 
-    else
+        return false;
+    }
+
+    const uint64_t pressed = profile->MappingTable.EvaluateHotkeys(deviceState, l_KeyboardState);
+    // exchange the bitmask, so a change is only
+    // queued once when both threads check it
+    uint64_t changed = pressed ^ profile->HotkeysPressed.exchange(pressed);
+
+    // queue the actions of the hotkeys which have
+    // been pressed or released since the previous check,
+    // so they don't block the emulation thread
+    for (int hotkey = 0; changed != 0; hotkey++, changed >>= 1)
     {
-        return value;
+        if (changed & 1)
+        {
+            l_HotkeyActionThread->QueueAction(hotkey, (pressed >> hotkey) & 1);
+        }
     }
+
+    return pressed != 0;
 }
 
-static double simulate_deadzone(const double n64InputAxis, const double maxAxis, const int deadzone, const double axisRange)
+static bool check_hotkeys(int Control)
 {
-    double axisAbsolute = std::abs(n64InputAxis);
+    InputProfile* profile = &l_InputProfiles[Control];
 
-    if (axisAbsolute <= deadzone)
+    // HotkeysThread might wake up before the input
+    // thread has polled the device, so update it first
+    if (profile->PluggedIn && profile->InputDevice.HasOpenDevice())
     {
-        axisAbsolute = 0; // No input when inside deadzone
-    }
-    else
-    {
-        // Create linear scaling factor from 0 at inner deadzone to MAX_AXIS at outer limit
-        axisAbsolute = (axisAbsolute - deadzone) * maxAxis / axisRange / axisAbsolute;
+        profile->InputDevice.UpdateState();
     }
 
-    return axisAbsolute;
+    return check_profile_hotkeys(profile, profile->InputDevice.GetState());
 }
 
-// Credit: MerryMage & fzurita
-static void simulate_octagon(const double inputX, const double inputY, const double deadzoneFactor, const double sensitivityFactor, int& outputX, int& outputY)
+static void get_keys(InputProfile* profile, BUTTONS* Keys)
 {
-    // don't increase emulated range at higher than 100% sensitivity
-    const double maxAxis     = N64_AXIS_PEAK * std::min(sensitivityFactor, 1.0);
-    const double maxDiagonal = MAX_DIAGONAL_VALUE * std::min(sensitivityFactor, 1.0);
-    const int    deadzone    = (int)(deadzoneFactor * N64_AXIS_PEAK * sensitivityFactor);
-    const double axisRange   = maxAxis - deadzone;
-    // scale to [-maxAxis, maxAxis]
-    double ax = std::min(inputX * sensitivityFactor, 1.0) * maxAxis;
-    double ay = std::min(inputY * sensitivityFactor, 1.0) * maxAxis;
-
-    // check whether (ax, ay) is within the circle of radius MAX_AXIS
-    double len = std::sqrt(ax*ax + ay*ay);
-    if (len <= maxAxis)
-    {
-        // scale inputs
-        ax *= simulate_deadzone(ax, maxAxis, deadzone, axisRange);
-        ay *= simulate_deadzone(ay, maxAxis, deadzone, axisRange);
-    }
-    else
+#ifdef VRU
+    // when we're emulating the VRU,
+    // we need to check the mic state
+    if (profile->DeviceNum == (int)InputDeviceType::EmulateVRU)
     {
-        // scale ax and ay to stay on the same line, but at the edge of the circle
-        len = maxAxis / len;
-        ax *= len;
-        ay *= len;
+        if (GetVRUMicState())
+        {
+            Keys->Value = 0x0020;
+        }
+        else
+        {
+            Keys->Value = 0x0000;
+        }
+        return;
     }
+#endif // VRU
+
+    // the input thread keeps the snapshot up-to-date,
+    // so we only have to read it once
+    const Utilities::InputDeviceState deviceState = profile->InputDevice.GetState();
 
-    // bound diagonals to an octagonal range [-69, 69]
-    if (ax != 0.0 && ay != 0.0)
+#ifdef HIDAPI
+    // measure how old the newest report is,
+    // HidThread timestamps every snapshot
+    if (profile->MeasureHidLatency && deviceState.Timestamp != 0)
     {
-        const double slope = ay / ax;
-        double edgex = std::copysign(maxAxis / (std::abs(slope) + (maxAxis - maxDiagonal) / maxDiagonal), ax);
-        const double edgey = std::copysign(std::min(std::abs(edgex * slope), maxAxis / (1.0 / std::abs(slope) + (maxAxis - maxDiagonal) / maxDiagonal)), ay);
-        edgex = edgey / slope;
+        const uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        Utilities::FrameTimeStatistics& statistics = l_HidLatencyStatistics[profile - l_InputProfiles];
 
-        const double scale = std::sqrt(edgex*edgex + edgey*edgey) / maxAxis;
-        ax *= scale;
-        ay *= scale;
+        statistics.AddTime(std::chrono::nanoseconds(now - deviceState.Timestamp));
+        statistics.EndFrame();
     }
+#endif // HIDAPI
 
-    outputX = (int)ax;
-    outputY = (int)ay;
-}
-
-static unsigned char data_crc(unsigned char *data, int length)
-{
-    unsigned char remainder = data[0];
+    const uint64_t eventTime = std::max(deviceState.ChangeTimestamp,
+        l_KeyboardChangeTimestamp.load(std::memory_order_relaxed));
 
-    int byte = 1;
-    unsigned char bit = 0;
+    // let the core measure the latency of the newest input event
+    if (CoreIsInputLatencyMeasured())
+    {
+        CoreInputLatencyRecordPoll(eventTime);
+    }
 
-    while (byte <= length)
+    // publish how long the newest input event
+    // waited for GetKeys, every controller calls
+    // GetKeys, so only publish each event once
+    if (eventTime > l_PolledEventTime)
     {
-        int highBit = ((remainder & 0x80) != 0);
-        remainder = remainder << 1;
+        const uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
 
-        remainder += (byte < length && data[byte] & (0x80 >> bit )) ? 1 : 0;
+        l_PolledEventTime = eventTime;
+        CoreMetricsSet(CoreMetric::InputPollLatency, (now - eventTime) / 1000);
+    }
 
-        remainder ^= (highBit) ? 0x85 : 0;
+    // disconnected devices are re-opened by InputDevice
+    // when SDLThread notices a hot-plug event
 
-        bit++;
-        byte += bit/8;
-        bit %= 8;
+    // when we've matched a hotkey,
+    // we don't need to check anything
+    // else
+    if (check_profile_hotkeys(profile, deviceState))
+    {
+        return;
     }
 
-    return remainder;
+    Keys->Value = profile->MappingTable.Evaluate(deviceState, l_KeyboardState);
 }
 
-static bool check_hotkeys(int Control)
+static void stop_input_movie(void)
 {
-    InputProfile* profile = &l_InputProfiles[Control];
+    if (l_InputMovie.IsPlaying())
+    {
+        if (l_InputMovie.HasDesynced())
+        {
+            CoreDebugCallbackMessage(CoreDebugMessageType::Warning, "RMG-Input: input movie playback has desynced");
+        }
+        CoreDebugCallbackMessage(CoreDebugMessageType::Info, "RMG-Input: stopped input movie playback");
+    }
+    else if (l_InputMovie.IsRecording())
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Info, "RMG-Input: stopped input movie recording");
+    }
+
+    l_InputMovie.Stop();
+}
 
-    int state = 0;
+static bool get_input_movie_header(m64p_input_movie_start start, Utilities::InputMovieHeader& header)
+{
+    CoreRomHeader romHeader;
 
-    // we only have to check for hotkeys
-    // when there's a controller opened
-    if (!profile->InputDevice.HasOpenDevice())
+    if (!CoreGetCurrentRomHeader(romHeader))
     {
         return false;
     }
 
-#define DEFINE_HOTKEY(mapping, pressed, function, function2) \
-    state = get_button_state(profile, &profile->mapping, true); \
-    if (state) \
-    { \
-        if (!profile->pressed) \
-        { \
-            profile->pressed = true; \
-            function; \
-        } \
-        return true; \
-    } \
-    else if (!state && profile->pressed) \
-    { \
-        function2; \
-        profile->pressed = false; \
-    }
-
-    DEFINE_HOTKEY(Hotkey_Shutdown,       Hotkey_Shutdown_Pressed,      CoreStopEmulation(), );
-    DEFINE_HOTKEY(Hotkey_Exit,           Hotkey_Exit_Pressed,          QGuiApplication::quit(), );
-    DEFINE_HOTKEY(Hotkey_SoftReset,      Hotkey_SoftReset_Pressed,     CoreResetEmulation(false), );
-    DEFINE_HOTKEY(Hotkey_Resume,         Hotkey_Resume_Pressed,        CoreIsEmulationPaused() ? CoreResumeEmulation() : CorePauseEmulation(), );
-    DEFINE_HOTKEY(Hotkey_Screenshot,     Hotkey_Screenshot_Pressed,    CoreTakeScreenshot(), );
-    DEFINE_HOTKEY(Hotkey_LimitFPS,       Hotkey_LimitFPS_Pressed,      CoreSetSpeedLimiterState(!CoreIsSpeedLimiterEnabled()), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor25,  Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(25), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor50,  Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(50), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor75,  Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(75), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor100, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(100), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor125, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(125), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor150, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(150), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor175, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(175), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor200, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(200), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor225, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(225), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor250, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(250), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor275, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(275), );
-    DEFINE_HOTKEY(Hotkey_SpeedFactor300, Hotkey_SpeedFactor_Pressed,   CoreSetSpeedFactor(300), );
-    DEFINE_HOTKEY(Hotkey_SaveState,      Hotkey_SaveState_Pressed,     CoreSaveState(), );
-    DEFINE_HOTKEY(Hotkey_LoadState,      Hotkey_LoadState_Pressed,     CoreLoadSaveState(), );
-    DEFINE_HOTKEY(Hotkey_GSButton,       Hotkey_GSButton_Pressed,      CorePressGamesharkButton(true), CorePressGamesharkButton(false));
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot0, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(0), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot1, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(1), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot2, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(2), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot3, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(3), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot4, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(4), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot5, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(5), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot6, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(6), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot7, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(7), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot8, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(8), );
-    DEFINE_HOTKEY(Hotkey_SaveStateSlot9, Hotkey_SaveStateSlot_Pressed, CoreSetSaveStateSlot(9), );
-    DEFINE_HOTKEY(Hotkey_Fullscreen,     Hotkey_Fullscreen_Pressed,    CoreToggleFullscreen(), );
-
-#undef DEFINE_HOTKEY
-    return false;
+    header.Start       = (uint16_t)start;
+    header.Controllers = 0;
+    header.CRC1        = romHeader.CRC1;
+    header.CRC2        = romHeader.CRC2;
+
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        if (l_InputProfiles[i].PluggedIn)
+        {
+            header.Controllers |= (1 << i);
+        }
+    }
+
+    return true;
 }
 
 static void sdl_init()
@@ -882,6 +1039,9 @@ EXPORT m64p_error CALL PluginStartup(m64p_dynlib_handle CoreLibHandle, void *Con
     CoreSetupDebugCallbackMessage(DebugCallback, Context);
 
     sdl_init();
+#ifdef HIDAPI
+    hid_init();
+#endif // HIDAPI
 
     l_SDLThread = new Thread::SDLThread(nullptr);
     l_SDLThread->start();
@@ -894,8 +1054,46 @@ EXPORT m64p_error CALL PluginStartup(m64p_dynlib_handle CoreLibHandle, void *Con
     l_HotkeysThread = new Thread::HotkeysThread(check_hotkeys, nullptr);
     l_HotkeysThread->start();
 
+    l_InputThread = new Thread::InputThread(poll_controllers, nullptr);
+    l_InputThread->start();
+
+    l_HotkeyActionThread = new Thread::HotkeyActionThread(run_hotkey_action, nullptr);
+    l_HotkeyActionThread->start();
+
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        InputProfile* profile = &l_InputProfiles[i];
+
+        profile->RumbleThread = new Thread::RumbleThread([profile](bool rumble)
+        {
+            if (rumble)
+            {
+                profile->InputDevice.StartRumble();
+            }
+            else
+            {
+                profile->InputDevice.StopRumble();
+            }
+        }, nullptr);
+        profile->RumbleThread->start();
+    }
+
     load_settings();
 
+#ifdef VRU
+    // start loading the speech recognition model
+    // when it'll be needed, so it's ready by the
+    // time the ROM registers its words
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        if (l_InputProfiles[i].DeviceNum == (int)InputDeviceType::EmulateVRU)
+        {
+            InitVRU();
+            break;
+        }
+    }
+#endif // VRU
+
     return M64ERR_SUCCESS;
 }
 
@@ -906,6 +1104,19 @@ EXPORT m64p_error CALL PluginShutdown(void)
         return M64ERR_NOT_INIT;
     }
 
+    l_InputThread->StopLoop();
+    l_InputThread->deleteLater();
+    l_InputThread = nullptr;
+
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        InputProfile* profile = &l_InputProfiles[i];
+
+        profile->RumbleThread->StopLoop();
+        profile->RumbleThread->deleteLater();
+        profile->RumbleThread = nullptr;
+    }
+
     close_controllers();
 
     l_SDLThread->StopLoop();
@@ -916,7 +1127,18 @@ EXPORT m64p_error CALL PluginShutdown(void)
     l_HotkeysThread->deleteLater();
     l_HotkeysThread = nullptr;
 
+    l_HotkeyActionThread->StopLoop();
+    l_HotkeyActionThread->deleteLater();
+    l_HotkeyActionThread = nullptr;
+
+#ifdef VRU
+    QuitVRU();
+#endif // VRU
+
     sdl_quit();
+#ifdef HIDAPI
+    hid_exit();
+#endif // HIDAPI
 
     return M64ERR_SUCCESS;
 }
@@ -969,7 +1191,7 @@ EXPORT m64p_error CALL PluginConfig2(int romConfig)
     l_SDLThread->SetAction(SDLThreadAction::SDLPumpEvents);
 
     UserInterface::MainDialog dialog(nullptr, l_SDLThread, romConfig);
-    dialog.exec();
+    const bool saved = dialog.exec() == QDialog::Accepted;
 
     l_SDLThread->SetAction(SDLThreadAction::None);
 
@@ -979,6 +1201,16 @@ EXPORT m64p_error CALL PluginConfig2(int romConfig)
         QThread::msleep(5);
     }
 
+    // compile the blobs of the saved sections,
+    // so loading them doesn't read the settings
+    if (saved)
+    {
+        for (const QString& section : dialog.GetSavedSections())
+        {
+            compile_profile_blob(section.toStdString());
+        }
+    }
+
     // reload settings
     load_settings();
 
@@ -1012,6 +1244,18 @@ EXPORT void CALL ControllerCommand(int Control, unsigned char* Command)
         return;
     }
 
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // a new frame has started when the core
+    // has rendered a frame since the previous command
+    const uint64_t currentFrame = CoreMetricsGet(CoreMetric::RenderedFrames);
+    if (l_HasCommandFrame && currentFrame != l_LastCommandFrame)
+    {
+        l_ControllerCommandStatistics.EndFrame();
+    }
+    l_LastCommandFrame = currentFrame;
+    l_HasCommandFrame  = true;
+
     InputProfile* profile = &l_InputProfiles[Control];
 
     switch (Command[2])
@@ -1042,14 +1286,7 @@ EXPORT void CALL ControllerCommand(int Control, unsigned char* Command)
                 unsigned int dwAddress = (Command[3] << 8) + (Command[4] & 0xE0);
                 if (dwAddress == PAK_IO_RUMBLE) 
                 {
-                    if (*data) 
-                    {
-                        profile->InputDevice.StartRumble();
-                    }
-                    else
-                    {
-                        profile->InputDevice.StopRumble();
-                    }
+                    profile->RumbleThread->SetRumble(*data != 0);
                 }
                 data[32] = data_crc( data, 32 );
             }
@@ -1059,99 +1296,45 @@ EXPORT void CALL ControllerCommand(int Control, unsigned char* Command)
         case RD_WRITEEPROM:
             break;
     }
+
+    l_ControllerCommandStatistics.AddTime(std::chrono::steady_clock::now() - startTime);
 }
 
 EXPORT void CALL GetKeys(int Control, BUTTONS* Keys)
 {
     InputProfile* profile = &l_InputProfiles[Control];
 
-    if (!profile->PluggedIn)
+    // the input thread doesn't poll while emulation
+    // is paused, so when it was sleeping, its snapshots
+    // are outdated and we have to poll the devices ourselves
+    if (l_InputThread->NotifyResumed())
     {
-        return;
+        poll_controllers();
     }
 
-#ifdef VRU
-    // when we're emulating the VRU,
-    // we need to check the mic state
-    if (profile->DeviceNum == (int)InputDeviceType::EmulateVRU)
+    if (!profile->PluggedIn)
     {
-        if (GetVRUMicState())
-        {
-            Keys->Value = 0x0020;
-        }
-        else
-        {
-            Keys->Value = 0x0000;
-        }
         return;
     }
-#endif // VRU
 
-    // check if device has been disconnected,
-    // if it has, try to open it again,
-    // only do this every 2 seconds to prevent lag
-    const auto currentTime  = std::chrono::high_resolution_clock::now();
-    const int secondsPassed = std::chrono::duration_cast<std::chrono::seconds>(currentTime - profile->LastDeviceCheckTime).count();
-    if (secondsPassed >= 2)
+    // when we're playing back an input movie,
+    // we don't need to read the input device
+    if (l_InputMovie.IsPlaying())
     {
-        profile->LastDeviceCheckTime = currentTime;
-
-        if (profile->DeviceNum != (int)InputDeviceType::Keyboard)
+        if (l_InputMovie.Play(Control, Keys->Value))
         {
-            if (profile->InputDevice.IsOpeningDevice())
-            {
-                return;
-            }
-
-            if (!profile->InputDevice.HasOpenDevice() || !profile->InputDevice.IsAttached())
-            {
-                profile->InputDevice.OpenDevice(profile->DeviceName, profile->DeviceNum);
-            }
+            return;
         }
+
+        stop_input_movie();
     }
 
-    // when we've matched a hotkey,
-    // we don't need to check anything
-    // else
-    if(check_hotkeys(Control))
+    get_keys(profile, Keys);
+
+    if (l_InputMovie.IsRecording())
     {
-        return;
+        l_InputMovie.Record(Control, Keys->Value);
     }
-
-    Keys->A_BUTTON     = get_button_state(profile, &profile->Button_A);
-    Keys->B_BUTTON     = get_button_state(profile, &profile->Button_B);
-    Keys->START_BUTTON = get_button_state(profile, &profile->Button_Start);
-    Keys->U_DPAD       = get_button_state(profile, &profile->Button_DpadUp);
-    Keys->D_DPAD       = get_button_state(profile, &profile->Button_DpadDown);
-    Keys->L_DPAD       = get_button_state(profile, &profile->Button_DpadLeft);
-    Keys->R_DPAD       = get_button_state(profile, &profile->Button_DpadRight);
-    Keys->U_CBUTTON    = get_button_state(profile, &profile->Button_CButtonUp);
-    Keys->D_CBUTTON    = get_button_state(profile, &profile->Button_CButtonDown);
-    Keys->L_CBUTTON    = get_button_state(profile, &profile->Button_CButtonLeft);
-    Keys->R_CBUTTON    = get_button_state(profile, &profile->Button_CButtonRight);
-    Keys->L_TRIG       = get_button_state(profile, &profile->Button_LeftTrigger);
-    Keys->R_TRIG       = get_button_state(profile, &profile->Button_RightTrigger);
-    Keys->Z_TRIG       = get_button_state(profile, &profile->Button_ZTrigger);
-
-    double inputX = 0, inputY = 0;
-    bool useButtonMapping = false;
-    inputY = get_axis_state(profile, &profile->AnalogStick_Up,    1, inputY, useButtonMapping);
-    inputY = get_axis_state(profile, &profile->AnalogStick_Down, -1, inputY, useButtonMapping);
-    inputX = get_axis_state(profile, &profile->AnalogStick_Left, -1, inputX, useButtonMapping);
-    inputX = get_axis_state(profile, &profile->AnalogStick_Right, 1, inputX, useButtonMapping);
-
-    int octagonX = 0, octagonY = 0;
-    simulate_octagon(
-        inputX, // inputX
-        inputY, // inputY
-        profile->DeadzoneValue / 100.0, // deadzoneFactor
-        profile->SensitivityValue / 100.0, // sensitivityFactor
-        octagonX, // outputX
-        octagonY  // outputY
-    );
-
-    Keys->X_AXIS = octagonX;
-    Keys->Y_AXIS = octagonY;
 }
 
 EXPORT void CALL InitiateControllers(CONTROL_INFO ControlInfo)
@@ -1181,25 +1364,146 @@ EXPORT void CALL ReadController(int Control, unsigned char *Command)
 EXPORT int CALL RomOpen(void)
 {
     l_HotkeysThread->SetState(HotkeysThreadState::RomOpened);
+    l_InputThread->SetState(InputThreadState::RomOpened);
     return 1;
 }
 
 EXPORT void CALL RomClosed(void)
 {
     l_HotkeysThread->SetState(HotkeysThreadState::RomClosed);
+    l_InputThread->SetState(InputThreadState::RomClosed);
     l_HasControlInfo = false;
+
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        l_InputProfiles[i].RumbleThread->SetRumble(false);
+    }
+
+    if (l_HasCommandFrame)
+    {
+        l_ControllerCommandStatistics.EndFrame();
+        CoreDebugCallbackMessage(CoreDebugMessageType::Info, l_ControllerCommandStatistics.GetSummary());
+    }
+    l_ControllerCommandStatistics.Reset();
+    l_HasCommandFrame = false;
+
+#ifdef HIDAPI
+    for (int i = 0; i < NUM_CONTROLLERS; i++)
+    {
+        if (l_InputProfiles[i].MeasureHidLatency)
+        {
+            CoreDebugCallbackMessage(CoreDebugMessageType::Info, l_HidLatencyStatistics[i].GetSummary());
+        }
+        l_HidLatencyStatistics[i].Reset();
+    }
+#endif // HIDAPI
+
+    stop_input_movie();
+
     close_controllers();
 #ifdef VRU
-    QuitVRU();
+    CloseVRU();
 #endif // VRU
 }
 
+EXPORT m64p_error CALL PluginStartInputMovieRecording(const char* path, m64p_input_movie_start start)
+{
+    Utilities::InputMovieHeader header;
+
+    if (l_SDLThread == nullptr)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    if (path == nullptr)
+    {
+        return M64ERR_INPUT_ASSERT;
+    }
+
+    if (!get_input_movie_header(start, header))
+    {
+        return M64ERR_INVALID_STATE;
+    }
+
+    if (!l_InputMovie.StartRecording(path, header))
+    {
+        return M64ERR_FILES;
+    }
+
+    CoreDebugCallbackMessage(CoreDebugMessageType::Info, "RMG-Input: started input movie recording: " + std::string(path));
+    return M64ERR_SUCCESS;
+}
+
+EXPORT m64p_error CALL PluginStartInputMoviePlayback(const char* path, m64p_input_movie_start start)
+{
+    Utilities::InputMovieHeader header;
+    Utilities::InputMovieHeader movieHeader;
+
+    if (l_SDLThread == nullptr)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    if (path == nullptr)
+    {
+        return M64ERR_INPUT_ASSERT;
+    }
+
+    if (!get_input_movie_header(start, header))
+    {
+        return M64ERR_INVALID_STATE;
+    }
+
+    if (!l_InputMovie.StartPlayback(path, movieHeader))
+    {
+        return M64ERR_FILES;
+    }
+
+    // a different ROM or controller setup won't
+    // play back correctly, but it might still be useful
+    if (movieHeader.CRC1 != header.CRC1 || movieHeader.CRC2 != header.CRC2)
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning, "RMG-Input: input movie was recorded with a different ROM");
+    }
+    if (movieHeader.Controllers != header.Controllers)
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning, "RMG-Input: input movie was recorded with different controllers plugged in");
+    }
+    if (movieHeader.Start != header.Start)
+    {
+        CoreDebugCallbackMessage(CoreDebugMessageType::Warning, "RMG-Input: input movie was recorded with a different start");
+    }
+
+    CoreDebugCallbackMessage(CoreDebugMessageType::Info, "RMG-Input: started input movie playback: " + std::string(path));
+    return M64ERR_SUCCESS;
+}
+
+EXPORT m64p_error CALL PluginStopInputMovie(void)
+{
+    if (l_SDLThread == nullptr)
+    {
+        return M64ERR_NOT_INIT;
+    }
+
+    stop_input_movie();
+    return M64ERR_SUCCESS;
+}
+
 EXPORT void CALL SDL_KeyDown(int keymod, int keysym)
 {
     l_KeyboardState[keysym] = true;
+    l_KeyboardChangeTimestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    if (l_HotkeysThread != nullptr)
+    {
+        l_HotkeysThread->NotifyInput();
+    }
 }
 
 EXPORT void CALL SDL_KeyUp(int keymod, int keysym)
 {
     l_KeyboardState[keysym] = false;
+    l_KeyboardChangeTimestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
 }
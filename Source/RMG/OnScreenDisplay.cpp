@@ -13,8 +13,46 @@
 
 #include <imgui.h>
 #include <backends/imgui_impl_opengl3.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 
+//
+// Local Defines
+//
+
+// interval at which the OSD windows are rebuilt,
+// the previous draw data is rendered in between
+#define OSD_REFRESH_INTERVAL std::chrono::milliseconds(500)
+
+// amount of frame times shown in the frame time graph
+#define OSD_FRAME_TIME_COUNT 128
+
+//
+// Local Structures
+//
+
+struct PerformanceStatistics
+{
+    float FramesPerSecond = 0.0f;
+    bool  HasSpeed        = false;
+    float Speed           = 0.0f;
+    int   TargetSpeed     = 0;
+
+    int   FrameTimeCount   = 0;
+    float FrameTimeP50     = 0.0f;
+    float FrameTimeP95     = 0.0f;
+    float FrameTimeP99     = 0.0f;
+    float FrameTimeMaximum = 0.0f;
+
+    bool     HasAudio        = false;
+    uint64_t AudioBufferFill = 0;
+    uint64_t AudioUnderruns  = 0;
+
+    bool  HasInput         = false;
+    float InputPollLatency = 0.0f;
+};
+
 //
 // Local Variables
 //
@@ -31,6 +69,207 @@ static float                                                       l_MessagePadd
 static float                                                       l_MessageOpacity  = 1.0f;
 static int                                                         l_MessageDuration = 3;
 
+static std::chrono::time_point<std::chrono::high_resolution_clock> l_InputLatencyTime;
+static CoreInputLatencyStatistics                                  l_InputLatencyStatistics;
+static bool                                                        l_HasInputLatencyStatistics = false;
+
+static std::atomic<bool>                                           l_PerformanceOverlay = false;
+static std::chrono::time_point<std::chrono::high_resolution_clock> l_PerformanceTime;
+static uint64_t                                                    l_PerformanceFrames       = 0;
+static uint64_t                                                    l_PerformanceEmulatedTime = 0;
+static PerformanceStatistics                                       l_PerformanceStatistics;
+// preallocated, so refreshing the statistics doesn't allocate
+static uint32_t                                                    l_FrameTimes[OSD_FRAME_TIME_COUNT];
+static float                                                       l_FrameTimeGraph[OSD_FRAME_TIME_COUNT];
+
+// the draw data of the last frame is rendered again until
+// the windows need to be rebuilt, so most buffer swaps
+// only have to upload the cached vertices
+static std::atomic<bool>                                           l_FrameDirty = true;
+static bool                                                        l_HasFrame   = false;
+static std::chrono::time_point<std::chrono::high_resolution_clock> l_FrameTime;
+static bool                                                        l_FrameShowedMessage     = false;
+static bool                                                        l_FrameShowedLatency     = false;
+static bool                                                        l_FrameShowedPerformance = false;
+
+//
+// Local Functions
+//
+
+static void set_next_window_position(int position)
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    // right bottom = ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 20.0f, io.DisplaySize.y - 20.0f), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
+    // right top    = ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 20.0f, 20.0f), ImGuiCond_Always, ImVec2(1.0f, 0));
+    // left  bottom = ImGui::SetNextWindowPos(ImVec2(20.0f, io.DisplaySize.y - 20.0f), ImGuiCond_Always, ImVec2(0.0f, 1.0f));
+    // left  top    = ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Always, ImVec2(0.0f, 0.0f));
+    switch (position)
+    {
+    default:
+    case 0: // left bottom
+        ImGui::SetNextWindowPos(ImVec2(l_MessagePaddingX, io.DisplaySize.y - l_MessagePaddingY), ImGuiCond_Always, ImVec2(0.0f, 1.0f));
+        break;
+    case 1: // left top
+        ImGui::SetNextWindowPos(ImVec2(l_MessagePaddingX, l_MessagePaddingY), ImGuiCond_Always, ImVec2(0.0f, 0.0f));
+        break;
+    case 2: // right top
+        ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - l_MessagePaddingX, l_MessagePaddingY), ImGuiCond_Always, ImVec2(1.0f, 0));
+        break;
+    case 3: // right bottom
+        ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - l_MessagePaddingX, io.DisplaySize.y - l_MessagePaddingY), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
+        break;
+    }
+}
+
+static void render_input_latency_stage(const char* name, const CoreInputLatencyStage& stage)
+{
+    ImGui::Text("%-13s %6.1f %6.1f %6.1f", name, stage.Median / 1000.0f, stage.P95 / 1000.0f, stage.Maximum / 1000.0f);
+}
+
+static void render_input_latency(std::chrono::time_point<std::chrono::high_resolution_clock> currentTime)
+{
+    // computing the statistics requires sorting
+    // all measured inputs, so only do it once a second
+    if (std::chrono::duration_cast<std::chrono::seconds>(currentTime - l_InputLatencyTime).count() >= 1)
+    {
+        l_HasInputLatencyStatistics = CoreGetInputLatencyStatistics(l_InputLatencyStatistics);
+        l_InputLatencyTime          = currentTime;
+    }
+
+    ImGui::SetNextWindowBgAlpha(l_MessageOpacity);
+    // show the statistics in the vertically
+    // opposite corner of the messages
+    set_next_window_position(l_MessagePosition ^ 1);
+
+    ImGui::Begin("InputLatency", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoFocusOnAppearing);
+    if (!l_HasInputLatencyStatistics)
+    {
+        ImGui::Text("Input latency: waiting for input");
+    }
+    else
+    {
+        ImGui::Text("Input latency (%llu inputs)", (unsigned long long)l_InputLatencyStatistics.Samples);
+        ImGui::Text("%-13s %6s %6s %6s", "ms", "median", "p95", "max");
+        render_input_latency_stage("Event -> Poll", l_InputLatencyStatistics.EventToPoll);
+        render_input_latency_stage("Poll -> Swap", l_InputLatencyStatistics.PollToSwap);
+        render_input_latency_stage("Event -> Swap", l_InputLatencyStatistics.EventToSwap);
+    }
+    ImGui::End();
+}
+
+static void update_performance_statistics(std::chrono::time_point<std::chrono::high_resolution_clock> currentTime)
+{
+    PerformanceStatistics& statistics = l_PerformanceStatistics;
+
+    const uint64_t frames       = CoreMetricsGet(CoreMetric::Frames);
+    const uint64_t emulatedTime = CoreMetricsGet(CoreMetric::EmulatedTime);
+    const double seconds        = std::chrono::duration<double>(currentTime - l_PerformanceTime).count();
+
+    // the metrics are reset when emulation starts,
+    // so only compute the rates when they've grown
+    if (seconds > 0 && frames >= l_PerformanceFrames && emulatedTime >= l_PerformanceEmulatedTime)
+    {
+        statistics.FramesPerSecond = (float)((frames - l_PerformanceFrames) / seconds);
+        // the speed is the emulated time against the wall time,
+        // the frame rate can't be used because games don't
+        // render a frame on every VI
+        statistics.Speed = (float)(((emulatedTime - l_PerformanceEmulatedTime) / 1000000.0) * 100.0 / seconds);
+    }
+
+    l_PerformanceFrames       = frames;
+    l_PerformanceEmulatedTime = emulatedTime;
+    l_PerformanceTime         = currentTime;
+
+    // the emulated time is published by the audio plugin
+    statistics.HasSpeed    = CoreMetricsIsPublished(CoreMetric::EmulatedTime);
+    statistics.TargetSpeed = CoreIsSpeedLimiterEnabled() ? CoreGetSpeedFactor() : 0;
+
+    statistics.FrameTimeCount = CoreMetricsGetFrameTimes(l_FrameTimes, OSD_FRAME_TIME_COUNT);
+    for (int i = 0; i < statistics.FrameTimeCount; i++)
+    {
+        l_FrameTimeGraph[i] = l_FrameTimes[i] / 1000.0f;
+    }
+
+    if (statistics.FrameTimeCount > 0)
+    {
+        const int count = statistics.FrameTimeCount;
+        std::sort(l_FrameTimes, l_FrameTimes + count);
+
+        statistics.FrameTimeP50     = l_FrameTimes[count / 2] / 1000.0f;
+        statistics.FrameTimeP95     = l_FrameTimes[(count * 95) / 100] / 1000.0f;
+        statistics.FrameTimeP99     = l_FrameTimes[(count * 99) / 100] / 1000.0f;
+        statistics.FrameTimeMaximum = l_FrameTimes[count - 1] / 1000.0f;
+    }
+
+    statistics.HasAudio        = CoreMetricsIsPublished(CoreMetric::AudioBufferFill);
+    statistics.AudioBufferFill = CoreMetricsGet(CoreMetric::AudioBufferFill);
+    statistics.AudioUnderruns  = CoreMetricsGet(CoreMetric::AudioUnderruns);
+
+    statistics.HasInput         = CoreMetricsIsPublished(CoreMetric::InputPollLatency);
+    statistics.InputPollLatency = CoreMetricsGet(CoreMetric::InputPollLatency) / 1000.0f;
+}
+
+static void render_performance(std::chrono::time_point<std::chrono::high_resolution_clock> currentTime)
+{
+    const PerformanceStatistics& statistics = l_PerformanceStatistics;
+
+    // the rates need some time to be accurate,
+    // so they're only updated every interval
+    if ((currentTime - l_PerformanceTime) >= OSD_REFRESH_INTERVAL)
+    {
+        update_performance_statistics(currentTime);
+    }
+
+    ImGui::SetNextWindowBgAlpha(l_MessageOpacity);
+    // show the overlay in the horizontally
+    // opposite corner of the messages
+    set_next_window_position(3 - l_MessagePosition);
+
+    ImGui::Begin("Performance", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoFocusOnAppearing);
+    ImGui::Text("FPS %5.1f", statistics.FramesPerSecond);
+    if (!statistics.HasSpeed)
+    {
+        ImGui::Text("Speed n/a (no audio)");
+    }
+    else if (statistics.TargetSpeed == 0)
+    {
+        ImGui::Text("Speed %3.0f%% (unlimited)", statistics.Speed);
+    }
+    else
+    {
+        ImGui::Text("Speed %3.0f%% (target %d%%)", statistics.Speed, statistics.TargetSpeed);
+    }
+
+    if (statistics.FrameTimeCount > 0)
+    {
+        ImGui::Text("Frame time (ms)  p50 %.1f  p95 %.1f  p99 %.1f  max %.1f",
+            statistics.FrameTimeP50, statistics.FrameTimeP95, statistics.FrameTimeP99, statistics.FrameTimeMaximum);
+        ImGui::PlotLines("##FrameTimes", l_FrameTimeGraph, statistics.FrameTimeCount, 0, nullptr,
+            0.0f, std::max(statistics.FrameTimeMaximum, 1000.0f / CoreMetricsGetVIRate() * 2.0f), ImVec2(240.0f, 40.0f));
+    }
+
+    if (statistics.HasAudio)
+    {
+        ImGui::Text("Audio buffer %llu ms, %llu underruns",
+            (unsigned long long)statistics.AudioBufferFill, (unsigned long long)statistics.AudioUnderruns);
+    }
+    else
+    {
+        ImGui::Text("Audio buffer n/a");
+    }
+
+    if (statistics.HasInput)
+    {
+        ImGui::Text("Input poll latency %.1f ms", statistics.InputPollLatency);
+    }
+    else
+    {
+        ImGui::Text("Input poll latency n/a");
+    }
+    ImGui::End();
+}
+
 //
 // Exported Functions
 //
@@ -68,6 +307,12 @@ void OnScreenDisplayShutdown(void)
     l_Message         = "";
     l_Initialized     = false;
     l_RenderingPaused = false;
+
+    l_HasInputLatencyStatistics = false;
+    l_PerformanceStatistics     = {};
+    l_PerformanceEmulatedTime   = 0;
+    l_PerformanceFrames         = 0;
+    l_HasFrame                  = false;
 }
 
 void OnScreenDisplayLoadSettings(void)
@@ -78,6 +323,8 @@ void OnScreenDisplayLoadSettings(void)
     l_MessagePaddingY = CoreSettingsGetIntValue(SettingsID::GUI_OnScreenDisplayPaddingY);
     l_MessageOpacity  = CoreSettingsGetFloatValue(SettingsID::GUI_OnScreenDisplayOpacity);
     l_MessageDuration = CoreSettingsGetIntValue(SettingsID::GUI_OnScreenDisplayDuration);
+    l_PerformanceOverlay = CoreSettingsGetBoolValue(SettingsID::GUI_OnScreenDisplayPerformance);
+    l_FrameDirty      = true;
 }
 
 bool OnScreenDisplaySetDisplaySize(int width, int height)
@@ -90,6 +337,7 @@ bool OnScreenDisplaySetDisplaySize(int width, int height)
     ImGuiIO& io    = ImGui::GetIO();
     io.IniFilename = nullptr;
     io.DisplaySize = ImVec2((float)width, (float)height);
+    l_FrameDirty   = true;
     return true;
 }
 
@@ -102,53 +350,74 @@ void OnScreenDisplaySetMessage(std::string message)
 
     l_Message     = message;
     l_MessageTime = std::chrono::high_resolution_clock::now();
+    l_FrameDirty  = true;
+}
+
+void OnScreenDisplaySetPerformanceOverlay(bool enabled)
+{
+    l_PerformanceOverlay = enabled;
 }
 
 void OnScreenDisplayRender(void)
 {
-    if (!l_Initialized || !l_Enabled || l_RenderingPaused || l_Message.empty())
+    if (!l_Initialized || !l_Enabled || l_RenderingPaused)
+    {
+        return;
+    }
+
+    const auto currentTime     = std::chrono::high_resolution_clock::now();
+    const int secondsPassed    = std::chrono::duration_cast<std::chrono::seconds>(currentTime - l_MessageTime).count();
+    const bool showMessage     = !l_Message.empty() && secondsPassed < l_MessageDuration;
+    const bool showLatency     = CoreIsInputLatencyMeasured();
+    const bool showPerformance = l_PerformanceOverlay;
+    if (!showMessage && !showLatency && !showPerformance)
     {
+        l_HasFrame = false;
         return;
     }
 
-    const auto currentTime  = std::chrono::high_resolution_clock::now();
-    const int secondsPassed = std::chrono::duration_cast<std::chrono::seconds>(currentTime - l_MessageTime).count();
-    if (secondsPassed >= l_MessageDuration)
+    // render the previous draw data again when
+    // the windows haven't changed and their
+    // contents don't need to be refreshed yet
+    if (l_HasFrame && !l_FrameDirty &&
+        showMessage == l_FrameShowedMessage &&
+        showLatency == l_FrameShowedLatency &&
+        showPerformance == l_FrameShowedPerformance &&
+        (currentTime - l_FrameTime) < OSD_REFRESH_INTERVAL)
     {
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
         return;
     }
 
+    l_FrameDirty             = false;
+    l_HasFrame               = true;
+    l_FrameTime              = currentTime;
+    l_FrameShowedMessage     = showMessage;
+    l_FrameShowedLatency     = showLatency;
+    l_FrameShowedPerformance = showPerformance;
+
     ImGui_ImplOpenGL3_NewFrame();
     ImGui::NewFrame();
-    
-    ImGuiIO& io = ImGui::GetIO();
 
-    ImGui::SetNextWindowBgAlpha(l_MessageOpacity);
+    if (showMessage)
+    {
+        ImGui::SetNextWindowBgAlpha(l_MessageOpacity);
+        set_next_window_position(l_MessagePosition);
 
-    // right bottom = ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 20.0f, io.DisplaySize.y - 20.0f), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
-    // right top    = ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 20.0f, 20.0f), ImGuiCond_Always, ImVec2(1.0f, 0));
-    // left  bottom = ImGui::SetNextWindowPos(ImVec2(20.0f, io.DisplaySize.y - 20.0f), ImGuiCond_Always, ImVec2(0.0f, 1.0f));
-    // left  top    = ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Always, ImVec2(0.0f, 0.0f));
-    switch (l_MessagePosition)
+        ImGui::Begin("Message", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoFocusOnAppearing); 
+        ImGui::Text("%s", l_Message.c_str());
+        ImGui::End();
+    }
+
+    if (showLatency)
     {
-    default:
-    case 0: // left bottom
-        ImGui::SetNextWindowPos(ImVec2(l_MessagePaddingX, io.DisplaySize.y - l_MessagePaddingY), ImGuiCond_Always, ImVec2(0.0f, 1.0f));
-        break;
-    case 1: // left top
-        ImGui::SetNextWindowPos(ImVec2(l_MessagePaddingX, l_MessagePaddingY), ImGuiCond_Always, ImVec2(0.0f, 0.0f));
-        break;
-    case 2: // right top
-        ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - l_MessagePaddingX, l_MessagePaddingY), ImGuiCond_Always, ImVec2(1.0f, 0));
-        break;
-    case 3: // right bottom
-        ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - l_MessagePaddingX, io.DisplaySize.y - l_MessagePaddingY), ImGuiCond_Always, ImVec2(1.0f, 1.0f));
-        break;
+        render_input_latency(currentTime);
     }
 
-    ImGui::Begin("Message", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoFocusOnAppearing); 
-    ImGui::Text("%s", l_Message.c_str());
-    ImGui::End();
+    if (showPerformance)
+    {
+        render_performance(currentTime);
+    }
 
     ImGui::Render();
 
@@ -27,6 +27,9 @@ bool OnScreenDisplaySetDisplaySize(int width, int height);
 // sets the current message to the OSD
 void OnScreenDisplaySetMessage(std::string message);
 
+// sets whether the performance overlay is shown
+void OnScreenDisplaySetPerformanceOverlay(bool enabled);
+
 // renders the OSD
 void OnScreenDisplayRender(void);
 
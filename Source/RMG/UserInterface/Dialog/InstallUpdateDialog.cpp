@@ -94,7 +94,15 @@ void InstallUpdateDialog::install(void)
     extractDirectory = this->temporaryDirectory;
     extractDirectory += "/extract";
 
-    if (!CoreUnzip(fullFilePath.toStdU32String(), extractDirectory.toStdU32String()))
+    auto progressCallback = [this](uint64_t extracted, uint64_t total)
+    {
+        if (total > 0)
+        {
+            this->progressBar->setValue(50 + (int)((extracted * 49) / total));
+        }
+    };
+
+    if (!CoreUnzip(fullFilePath.toStdU32String(), extractDirectory.toStdU32String(), progressCallback))
     {
         this->showErrorMessage("CoreUnzip() Failed!", QString::fromStdString(CoreGetError()));
         this->reject();
@@ -405,6 +405,7 @@ void SettingsDialog::loadInterfaceOSDSettings(void)
     this->osdHorizontalPaddingSpinBox->setValue(CoreSettingsGetIntValue(SettingsID::GUI_OnScreenDisplayPaddingX));
     this->osdOpacitySpinBox->setValue(CoreSettingsGetFloatValue(SettingsID::GUI_OnScreenDisplayOpacity));
     this->osdDurationSpinBox->setValue(CoreSettingsGetIntValue(SettingsID::GUI_OnScreenDisplayDuration));
+    this->osdInputLatencyCheckBox->setChecked(CoreSettingsGetBoolValue(SettingsID::Core_MeasureInputLatency));
 }
 
 void SettingsDialog::loadInterfaceMiscSettings(void)
@@ -568,6 +569,7 @@ void SettingsDialog::loadDefaultInterfaceOSDSettings(void)
     this->osdHorizontalPaddingSpinBox->setValue(CoreSettingsGetDefaultIntValue(SettingsID::GUI_OnScreenDisplayPaddingX));
     this->osdOpacitySpinBox->setValue(CoreSettingsGetDefaultFloatValue(SettingsID::GUI_OnScreenDisplayOpacity));
     this->osdDurationSpinBox->setValue(CoreSettingsGetDefaultIntValue(SettingsID::GUI_OnScreenDisplayDuration));
+    this->osdInputLatencyCheckBox->setChecked(CoreSettingsGetDefaultBoolValue(SettingsID::Core_MeasureInputLatency));
 }
 
 void SettingsDialog::loadDefaultInterfaceMiscSettings(void)
@@ -775,6 +777,7 @@ void SettingsDialog::saveInterfaceOSDSettings(void)
     CoreSettingsSetValue(SettingsID::GUI_OnScreenDisplayPaddingX, this->osdHorizontalPaddingSpinBox->value());
     CoreSettingsSetValue(SettingsID::GUI_OnScreenDisplayOpacity, (float)this->osdOpacitySpinBox->value());
     CoreSettingsSetValue(SettingsID::GUI_OnScreenDisplayDuration, this->osdDurationSpinBox->value());
+    CoreSettingsSetValue(SettingsID::Core_MeasureInputLatency, this->osdInputLatencyCheckBox->isChecked());
 }
 
 void SettingsDialog::saveInterfaceMiscSettings(void)
@@ -810,6 +813,7 @@ void SettingsDialog::commonHotkeySettings(SettingsDialogAction action)
         { this->hardResetKeyButton, SettingsID::KeyBinding_HardReset },
         { this->pauseKeyButton, SettingsID::KeyBinding_Resume },
         { this->generateBitmapKeyButton, SettingsID::KeyBinding_Screenshot },
+        { this->audioCaptureKeyButton, SettingsID::KeyBinding_AudioCapture },
         { this->limitFPSKeyButton, SettingsID::KeyBinding_LimitFPS },
         { this->saveStateKeyButton, SettingsID::KeyBinding_SaveState },
         { this->saveAsKeyButton, SettingsID::KeyBinding_SaveAs },
@@ -861,6 +865,7 @@ void SettingsDialog::commonHotkeySettings(SettingsDialogAction action)
     std::vector<keybinding> keybindings_View =
     {
         { this->fullscreenKeyButton, SettingsID::KeyBinding_Fullscreen },
+        { this->performanceOverlayKeyButton, SettingsID::KeyBinding_PerformanceOverlay },
         { this->logKeyButton, SettingsID::Keybinding_ViewLog },
         { this->refreshRomListKeyButton, SettingsID::KeyBinding_RefreshROMList }
     };
@@ -1209,6 +1214,7 @@ void SettingsDialog::on_KeybindButton_KeybindingChanged(KeybindButton* button)
         this->inputSettingsKeyButton,
         this->settingsKeyButton,
         this->logKeyButton,
+        this->performanceOverlayKeyButton,
         this->refreshRomListKeyButton,
     };
 
@@ -1219,6 +1225,7 @@ void SettingsDialog::on_KeybindButton_KeybindingChanged(KeybindButton* button)
         this->hardResetKeyButton,
         this->pauseKeyButton,
         this->generateBitmapKeyButton,
+        this->audioCaptureKeyButton,
         this->limitFPSKeyButton,
         this->speedFactor25KeyButton,
         this->speedFactor50KeyButton,
@@ -1256,6 +1263,7 @@ void SettingsDialog::on_KeybindButton_KeybindingChanged(KeybindButton* button)
         this->settingsKeyButton,
         this->logKeyButton,
         this->fullscreenKeyButton,
+        this->performanceOverlayKeyButton,
     };
 
     QList<KeybindButton*> keybindButtons;
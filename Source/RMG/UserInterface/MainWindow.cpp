@@ -34,6 +34,7 @@
 #include <QStatusBar>
 #include <QString>
 #include <QUrl>
+#include <QDateTime>
 #include <QActionGroup> 
 #include <QTimer>
 #include <cmath>
@@ -579,6 +580,20 @@ void MainWindow::updateActions(bool inEmulation, bool isPaused)
     keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_Screenshot));
     this->action_System_Screenshot->setEnabled(inEmulation);
     this->action_System_Screenshot->setShortcut(QKeySequence(keyBinding));
+    keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_AudioCapture));
+    this->action_System_AudioCapture->setEnabled(inEmulation);
+    this->action_System_AudioCapture->setShortcut(QKeySequence(keyBinding));
+    if (!inEmulation)
+    {
+        // the audio plugin stops the capture when emulation ends
+        this->action_System_AudioCapture->setChecked(false);
+    }
+    this->action_System_InputMovie->setEnabled(inEmulation);
+    if (!inEmulation)
+    {
+        // the input plugin stops the movie when emulation ends
+        this->action_System_InputMovie->setChecked(false);
+    }
     keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_LimitFPS));
     this->action_System_LimitFPS->setEnabled(inEmulation);
     this->action_System_LimitFPS->setShortcut(QKeySequence(keyBinding));
@@ -668,6 +683,8 @@ void MainWindow::updateActions(bool inEmulation, bool isPaused)
     keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_Fullscreen));
     this->action_View_Fullscreen->setEnabled(inEmulation);
     this->action_View_Fullscreen->setShortcut(QKeySequence(keyBinding));
+    keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_PerformanceOverlay));
+    this->action_View_PerformanceOverlay->setShortcut(QKeySequence(keyBinding));
     keyBinding = QString::fromStdString(CoreSettingsGetStringValue(SettingsID::KeyBinding_RefreshROMList));
     this->action_View_RefreshRoms->setEnabled(!inEmulation);
     this->action_View_RefreshRoms->setShortcut(QKeySequence(keyBinding));
@@ -815,7 +832,8 @@ void MainWindow::configureActions(void)
         this->action_System_StartRom, this->action_System_OpenCombo,
         this->action_System_Shutdown, this->action_System_SoftReset,
         this->action_System_HardReset, this->action_System_Pause,
-        this->action_System_Screenshot, this->action_System_LimitFPS,
+        this->action_System_Screenshot, this->action_System_AudioCapture,
+        this->action_System_InputMovie, this->action_System_LimitFPS,
         this->actionSpeed25, this->actionSpeed50, this->actionSpeed75,
         this->actionSpeed100, this->actionSpeed125, this->actionSpeed150,
         this->actionSpeed175, this->actionSpeed200, this->actionSpeed225,
@@ -832,8 +850,8 @@ void MainWindow::configureActions(void)
         this->action_Settings_Rsp, this->action_Settings_Input,
         this->action_Settings_Settings,
         // View actions
-        this->action_View_Fullscreen, this->action_View_RefreshRoms,
-        this->action_View_Log,
+        this->action_View_Fullscreen, this->action_View_PerformanceOverlay,
+        this->action_View_RefreshRoms, this->action_View_Log,
         // Help actions
         this->action_Help_Github, this->action_Help_About,
     });
@@ -908,6 +926,7 @@ void MainWindow::configureActions(void)
     // configure toolbar & statusbar actions
     this->action_View_Toolbar->setChecked(CoreSettingsGetBoolValue(SettingsID::GUI_Toolbar));
     this->action_View_StatusBar->setChecked(CoreSettingsGetBoolValue(SettingsID::GUI_StatusBar));
+    this->action_View_PerformanceOverlay->setChecked(CoreSettingsGetBoolValue(SettingsID::GUI_OnScreenDisplayPerformance));
 
     // configure ROM browser view actions
     QActionGroup* romBrowserViewActionGroup = new QActionGroup(this);
@@ -942,6 +961,10 @@ void MainWindow::connectActionSignals(void)
     connect(this->action_System_Pause, &QAction::triggered, this, &MainWindow::on_Action_System_Pause);
     connect(this->action_System_Screenshot, &QAction::triggered, this,
             &MainWindow::on_Action_System_Screenshot);
+    connect(this->action_System_AudioCapture, &QAction::triggered, this,
+            &MainWindow::on_Action_System_AudioCapture);
+    connect(this->action_System_InputMovie, &QAction::triggered, this,
+            &MainWindow::on_Action_System_InputMovie);
     connect(this->action_System_LimitFPS, &QAction::triggered, this, &MainWindow::on_Action_System_LimitFPS);
     connect(this->action_System_SaveState, &QAction::triggered, this, &MainWindow::on_Action_System_SaveState);
     connect(this->action_System_SaveAs, &QAction::triggered, this, &MainWindow::on_Action_System_SaveAs);
@@ -963,6 +986,8 @@ void MainWindow::connectActionSignals(void)
     connect(this->action_View_GameGrid, &QAction::toggled, this, &MainWindow::on_Action_View_GameGrid);
     connect(this->action_View_UniformSize, &QAction::toggled, this, &MainWindow::on_Action_View_UniformSize);
     connect(this->action_View_Fullscreen, &QAction::triggered, this, &MainWindow::on_Action_View_Fullscreen);
+    connect(this->action_View_PerformanceOverlay, &QAction::toggled, this,
+            &MainWindow::on_Action_View_PerformanceOverlay);
     connect(this->action_View_RefreshRoms, &QAction::triggered, this, &MainWindow::on_Action_View_RefreshRoms);
     connect(this->action_View_ClearRomCache, &QAction::triggered, this, &MainWindow::on_Action_View_ClearRomCache);
     connect(this->action_View_Log, &QAction::triggered, this, &MainWindow::on_Action_View_Log);
@@ -1340,6 +1365,76 @@ void MainWindow::on_Action_System_Screenshot(void)
     }
 }
 
+void MainWindow::on_Action_System_AudioCapture(void)
+{
+    bool enabled;
+
+    enabled = this->action_System_AudioCapture->isChecked();
+
+    if (enabled)
+    {
+        std::filesystem::path path = CoreGetScreenshotDirectory();
+        path /= "audio-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss").toStdString();
+
+        if (!CorePluginsStartAudioCapture(path))
+        {
+            this->action_System_AudioCapture->setChecked(false);
+            this->showErrorMessage("CorePluginsStartAudioCapture() Failed!", QString::fromStdString(CoreGetError()));
+        }
+        else
+        {
+            OnScreenDisplaySetMessage("Started audio capture.");
+        }
+    }
+    else
+    {
+        if (!CorePluginsStopAudioCapture())
+        {
+            this->showErrorMessage("CorePluginsStopAudioCapture() Failed!", QString::fromStdString(CoreGetError()));
+        }
+        else
+        {
+            OnScreenDisplaySetMessage("Stopped audio capture.");
+        }
+    }
+}
+
+void MainWindow::on_Action_System_InputMovie(void)
+{
+    bool enabled;
+
+    enabled = this->action_System_InputMovie->isChecked();
+
+    if (enabled)
+    {
+        std::filesystem::path path = CoreGetScreenshotDirectory();
+        path /= "input-" + QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss").toStdString() + ".rmgm";
+
+        // the movie starts from a save state
+        // which is saved next to the movie
+        if (!CoreStartInputMovieRecording(path, CoreInputMovieStart::SaveState))
+        {
+            this->action_System_InputMovie->setChecked(false);
+            this->showErrorMessage("CoreStartInputMovieRecording() Failed!", QString::fromStdString(CoreGetError()));
+        }
+        else
+        {
+            OnScreenDisplaySetMessage("Started input movie recording.");
+        }
+    }
+    else
+    {
+        if (!CoreStopInputMovie())
+        {
+            this->showErrorMessage("CoreStopInputMovie() Failed!", QString::fromStdString(CoreGetError()));
+        }
+        else
+        {
+            OnScreenDisplaySetMessage("Stopped input movie recording.");
+        }
+    }
+}
+
 void MainWindow::on_Action_System_LimitFPS(void)
 {
     bool enabled, ret;
@@ -1609,6 +1704,12 @@ void MainWindow::on_Action_View_Fullscreen(void)
     }
 }
 
+void MainWindow::on_Action_View_PerformanceOverlay(bool checked)
+{
+    CoreSettingsSetValue(SettingsID::GUI_OnScreenDisplayPerformance, checked);
+    OnScreenDisplaySetPerformanceOverlay(checked);
+}
+
 void MainWindow::on_Action_View_RefreshRoms(void)
 {
     if (!this->ui_Widget_RomBrowser->IsRefreshingRomList())
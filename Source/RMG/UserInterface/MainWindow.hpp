@@ -156,6 +156,8 @@ class MainWindow : public QMainWindow, private Ui::MainWindow
     void on_Action_System_HardReset(void);
     void on_Action_System_Pause(void);
     void on_Action_System_Screenshot(void);
+    void on_Action_System_AudioCapture(void);
+    void on_Action_System_InputMovie(void);
     void on_Action_System_LimitFPS(void);
     void on_Action_System_SpeedFactor(int factor);
     void on_Action_System_SaveState(void);
@@ -179,6 +181,7 @@ class MainWindow : public QMainWindow, private Ui::MainWindow
     void on_Action_View_GameGrid(bool checked);
     void on_Action_View_UniformSize(bool checked);
     void on_Action_View_Fullscreen(void);
+    void on_Action_View_PerformanceOverlay(bool checked);
     void on_Action_View_RefreshRoms(void);
     void on_Action_View_ClearRomCache(void);
     void on_Action_View_Log(void);
@@ -27,9 +27,18 @@ OGLWidget::~OGLWidget(void)
 
 void OGLWidget::MoveContextToThread(QThread* thread)
 {
+    bool valid;
+
     this->GetContext()->doneCurrent();
-    this->GetContext()->create();
+    valid = this->GetContext()->create();
     this->GetContext()->moveToThread(thread);
+
+    {
+        std::lock_guard<std::mutex> lock(this->contextMutex);
+        this->contextThread = thread;
+        this->contextValid  = valid;
+    }
+    this->contextCondition.notify_all();
 }
 
 QOpenGLContext* OGLWidget::GetContext()
@@ -37,6 +46,20 @@ QOpenGLContext* OGLWidget::GetContext()
     return this->openGLcontext;
 }
 
+bool OGLWidget::WaitForContext(QThread* thread, int timeout)
+{
+    std::unique_lock<std::mutex> lock(this->contextMutex);
+
+    this->contextCondition.wait_for(lock, std::chrono::milliseconds(timeout), [this, thread]()
+    {
+        return this->contextThread == thread &&
+                (!this->contextValid || this->windowVisible);
+    });
+
+    return this->contextThread == thread &&
+            this->contextValid && this->windowVisible;
+}
+
 void OGLWidget::SetHideCursor(bool hide)
 {
     this->setCursor(hide ? Qt::BlankCursor : Qt::ArrowCursor);
@@ -73,3 +96,22 @@ void OGLWidget::timerEvent(QTimerEvent *event)
         this->timerId = 0;
     }
 }
+
+void OGLWidget::showEvent(QShowEvent *event)
+{
+    QWindow::showEvent(event);
+
+    {
+        std::lock_guard<std::mutex> lock(this->contextMutex);
+        this->windowVisible = true;
+    }
+    this->contextCondition.notify_all();
+}
+
+void OGLWidget::hideEvent(QHideEvent *event)
+{
+    QWindow::hideEvent(event);
+
+    std::lock_guard<std::mutex> lock(this->contextMutex);
+    this->windowVisible = false;
+}
@@ -17,6 +17,9 @@
 #include <QOpenGLContext>
 #include <QWidget>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace UserInterface
 {
 namespace Widget
@@ -30,6 +33,12 @@ class OGLWidget : public QWindow
     void MoveContextToThread(QThread* thread);
     QOpenGLContext* GetContext();
 
+    // waits until the context has been moved to the thread
+    // and the window is visible, returns false when the
+    // context couldn't be created or when it took longer
+    // than timeout milliseconds
+    bool WaitForContext(QThread* thread, int timeout);
+
     void SetHideCursor(bool hide);
 
     QWidget *GetWidget(void);
@@ -37,6 +46,8 @@ class OGLWidget : public QWindow
   protected:
     void resizeEvent(QResizeEvent *) Q_DECL_OVERRIDE;
     void timerEvent(QTimerEvent *) Q_DECL_OVERRIDE;
+    void showEvent(QShowEvent *) Q_DECL_OVERRIDE;
+    void hideEvent(QHideEvent *) Q_DECL_OVERRIDE;
 
   private:
     QWidget* widgetContainer      = nullptr;
@@ -44,6 +55,15 @@ class OGLWidget : public QWindow
     int width                     = 0;
     int height                    = 0;
     int timerId                   = 0;
+
+    // state of the context & window,
+    // guarded by contextMutex because
+    // the render thread waits on it
+    std::mutex contextMutex;
+    std::condition_variable contextCondition;
+    QThread* contextThread = nullptr;
+    bool contextValid      = false;
+    bool windowVisible     = false;
 };
 } // namespace Widget
 } // namespace UserInterface
@@ -9,6 +9,9 @@
  */
 #include "VidExt.hpp"
 
+#include <RMG-Core/InputLatency.hpp>
+#include <RMG-Core/Metrics.hpp>
+#include <RMG-Core/Error.hpp>
 #include <RMG-Core/VidExt.hpp>
 #include <RMG-Core/m64p/Api.hpp>
 #include "OnScreenDisplay.hpp"
@@ -18,6 +21,14 @@
 #include <QThread>
 #include <QScreen>
 
+//
+// Local Defines
+//
+
+// maximum amount of milliseconds the render thread
+// waits for the main thread to set up the OpenGL window
+#define VIDEXT_OGL_TIMEOUT 10000
+
 //
 // Local Variables
 //
@@ -34,18 +45,34 @@ static QSurfaceFormat l_SurfaceFormat;
 // VidExt Functions
 //
 
-static void VidExt_OglSetup(void)
+static bool VidExt_OglWait(std::string function)
+{
+    if (!l_OGLWidget->WaitForContext(QThread::currentThread(), VIDEXT_OGL_TIMEOUT))
+    {
+        CoreSetError(function + ": the OpenGL context or window isn't ready!");
+        return false;
+    }
+
+    return true;
+}
+
+static bool VidExt_OglSetup(void)
 {
     l_EmuThread->on_VidExt_SetupOGL(l_SurfaceFormat, QThread::currentThread());
 
-    while (!l_OGLWidget->isVisible() ||
-           !l_OGLWidget->GetContext()->isValid())
+    if (!VidExt_OglWait("VidExt_OglSetup"))
     {
-        continue;
+        return false;
+    }
+
+    if (!l_OGLWidget->GetContext()->makeCurrent(l_OGLWidget))
+    {
+        CoreSetError("VidExt_OglSetup: QOpenGLContext::makeCurrent() Failed!");
+        return false;
     }
 
-    l_OGLWidget->GetContext()->makeCurrent(l_OGLWidget);
     l_VidExtInitialized = true;
+    return true;
 }
 
 static m64p_error VidExt_Init(void)
@@ -90,9 +117,9 @@ static m64p_error VidExt_ListRates(m64p_2d_size Size, int *NumRates, int *Rates)
 
 static m64p_error VidExt_SetMode(int Width, int Height, int BitsPerPixel, int ScreenMode, int Flags)
 {
-    if (!l_VidExtInitialized)
+    if (!l_VidExtInitialized && !VidExt_OglSetup())
     {
-        VidExt_OglSetup();
+        return M64ERR_SYSTEM_FAIL;
     }
 
     // try to initialize the OSD
@@ -122,6 +149,13 @@ static m64p_error VidExt_SetMode(int Width, int Height, int BitsPerPixel, int Sc
             break;
     }
 
+    // the window might be re-created when
+    // switching between windowed & fullscreen
+    if (!VidExt_OglWait("VidExt_SetMode"))
+    {
+        return M64ERR_SYSTEM_FAIL;
+    }
+
     OnScreenDisplaySetDisplaySize(Width, Height);
     return M64ERR_SUCCESS;
 }
@@ -271,6 +305,9 @@ static m64p_error VidExt_GLSwapBuf(void)
     l_OGLWidget->GetContext()->swapBuffers(l_OGLWidget);
     l_OGLWidget->GetContext()->makeCurrent(l_OGLWidget);
 
+    CoreInputLatencyRecordSwap();
+    CoreMetricsRecordFrame();
+
     return M64ERR_SUCCESS;
 }
 
@@ -296,6 +333,11 @@ static m64p_error VidExt_ToggleFS(void)
     else
     {
         l_EmuThread->on_VidExt_ToggleFS((videoMode == M64VIDEO_WINDOWED));
+
+        if (!VidExt_OglWait("VidExt_ToggleFS"))
+        {
+            return M64ERR_SYSTEM_FAIL;
+        }
     }
 
     return M64ERR_SUCCESS;
@@ -304,6 +346,13 @@ static m64p_error VidExt_ToggleFS(void)
 static m64p_error VidExt_ResizeWindow(int Width, int Height)
 {
     l_EmuThread->on_VidExt_ResizeWindow(Width, Height);
+
+    if (QThread::currentThread() == l_RenderThread &&
+        !VidExt_OglWait("VidExt_ResizeWindow"))
+    {
+        return M64ERR_SYSTEM_FAIL;
+    }
+
     OnScreenDisplaySetDisplaySize(Width, Height);
     return M64ERR_SUCCESS;
 }
@@ -135,6 +135,8 @@ int main(int argc, char **argv)
     QCommandLineOption noGuiOption({"n", "nogui"}, "Hides GUI elements (menubar, toolbar, statusbar)");
     QCommandLineOption quitAfterEmulationOption({"q", "quit-after-emulation"}, "Quits RMG when emulation has finished");
     QCommandLineOption diskOption("disk", "64DD Disk to open ROM in combination with", "64DD Disk");
+    QCommandLineOption recordInputOption("record-input", "Records the input from power-on to an input movie", "file");
+    QCommandLineOption playInputOption("play-input", "Plays back an input movie", "file");
 
 #ifndef PORTABLE_INSTALL
     parser.addOption(libPathOption);
@@ -147,6 +149,8 @@ int main(int argc, char **argv)
     parser.addOption(noGuiOption);
     parser.addOption(quitAfterEmulationOption);
     parser.addOption(diskOption);
+    parser.addOption(recordInputOption);
+    parser.addOption(playInputOption);
     parser.addPositionalArgument("ROM", "ROM to open");
 
     // parse arguments
@@ -188,6 +192,17 @@ int main(int argc, char **argv)
     QStringList args = parser.positionalArguments();
     if (!args.empty())
     {
+        // input movies start with the emulation,
+        // so they have to be set up before opening the ROM
+        if (parser.isSet(recordInputOption))
+        {
+            CoreStartInputMovieRecording(parser.value(recordInputOption).toStdString(), CoreInputMovieStart::PowerOn);
+        }
+        else if (parser.isSet(playInputOption))
+        {
+            CoreStartInputMoviePlayback(parser.value(playInputOption).toStdString());
+        }
+
         window.OpenROM(args.at(0), parser.value(diskOption), parser.isSet(fullscreenOption), parser.isSet(quitAfterEmulationOption));
     }
 